@@ -1,8 +1,78 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <vector>
+
 #include "sudoku.hh"
+#include "sudoku_arena.hh"
+#include "sudoku_cache.hh"
+#include "sudoku_heuristic.hh"
+#include "sudoku_session.hh"
+#include "sudoku_transposition.hh"
 #include "test-sudoku.hh"
 
+/* Calls to the global allocator, counted by replacing every form of operator new and delete */
+static std::atomic<size_t> global_allocations{0};
+
+static void *CountedAllocate(size_t size, size_t alignment)
+{
+    void *memory = nullptr;
+
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    size = (0 != size) ? size : 1;
+    if (alignment <= alignof(std::max_align_t))
+    {
+        memory = std::malloc(size);
+    }
+    else if (0 != posix_memalign(&memory, alignment, size))
+    {
+        memory = nullptr;
+    }
+
+    return memory;
+}
+
+static void *CountedNew(size_t size, size_t alignment)
+{
+    void *memory = CountedAllocate(size, alignment);
+    if (nullptr == memory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void *operator new(size_t size) { return CountedNew(size, 0); }
+void *operator new[](size_t size) { return CountedNew(size, 0); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return CountedAllocate(size, 0); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return CountedAllocate(size, 0); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+#if defined(__cpp_aligned_new)
+void *operator new(size_t size, std::align_val_t alignment) { return CountedNew(size, (size_t)alignment); }
+void *operator new[](size_t size, std::align_val_t alignment) { return CountedNew(size, (size_t)alignment); }
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return CountedAllocate(size, (size_t)alignment); }
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return CountedAllocate(size, (size_t)alignment); }
+void operator delete(void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept { std::free(memory); }
+#endif
+
 static void Sudoku_Puzzles0(benchmark::State &state)
 {
     for (auto _ : state)
@@ -62,10 +132,547 @@ static void Sudoku_Puzzles6(benchmark::State &state)
     }
 }
 
+/**
+ * @brief Solves a complete dataset with the selected engine.
+ *
+ * Registered for every dataset and engine to compare the pruning engine against
+ * the Dancing Links engine. Excluded from the default test run.
+ */
+static void Sudoku_Engine(benchmark::State &state, std::string file_name, Sudoku_Engine_T engine)
+{
+    for (auto _ : state)
+    {
+        auto result = Process_File(file_name, engine);
+        state.counters["puzzles"] = std::get<3>(result);
+        state.counters["solve_calls"] = GetSolveCalls();
+        state.counters["max_level"] = GetMaxLevel();
+
+        ResetMaxLevel();
+        ResetSolveCalls();
+    }
+}
+
+/**
+ * @brief Solves a complete dataset with a branching heuristic.
+ *
+ * Registered for every built-in heuristic and every dataset, to choose the heuristic of a
+ * workload by nodes and time. Excluded from the default test run.
+ */
+static void Sudoku_Heuristic(benchmark::State &state, std::string file_name, const Sudoku_Heuristic_T *heuristic)
+{
+    for (auto _ : state)
+    {
+        unsigned long nodes = 0;
+        unsigned long backtracks = 0;
+
+        auto result = Process_File(file_name, [&](SudokuPuzzle &p)
+                                   {
+            SudokuSolveStats stats = {};
+            auto rc = p.Solve(*heuristic, &stats);
+            nodes += stats.solve_calls;
+            backtracks += stats.backtracks;
+            return rc; });
+
+        state.counters["puzzles"] = std::get<3>(result);
+        state.counters["solved"] = std::get<0>(result);
+        state.counters["nodes"] = (double)nodes;
+        state.counters["backtracks"] = (double)backtracks;
+
+        ResetMaxLevel();
+        ResetSolveCalls();
+    }
+}
+
+static int register_heuristic_benchmarks = []()
+{
+    for (unsigned int h = 0; h < Sudoku_NumHeuristics; h++)
+    {
+        for (size_t f = 0; f < testFileNames.size(); f++)
+        {
+            std::string name = std::string("Sudoku_Heuristic/") + Sudoku_Heuristics[h].name + "_Puzzles" + std::to_string(f);
+            benchmark::RegisterBenchmark(name.c_str(), Sudoku_Heuristic, testFileNames[f], &Sudoku_Heuristics[h])
+                ->Unit(benchmark::kMillisecond)
+                ->Iterations(1);
+        }
+    }
+    return 0;
+}();
+
+/**
+ * @brief Nodes against time of each propagation level on a dataset.
+ *
+ * Stronger levels spend more time per node to search fewer nodes; the level that pays off
+ * depends on the workload. Registered for every level and every dataset, excluded from the
+ * default test run.
+ */
+static void Sudoku_Propagation(benchmark::State &state, std::string file_name, Sudoku_Propagation_T level)
+{
+    for (auto _ : state)
+    {
+        unsigned long nodes = 0;
+        unsigned long sweeps = 0;
+        Sudoku_PropagationStats_T deductions = {};
+
+        auto result = Process_File(file_name, [&](SudokuPuzzle &p)
+                                   {
+            SudokuSolveOptions options;
+            SudokuSolveStats stats = {};
+            options.propagation = level;
+            auto rc = p.Solve(options, &stats);
+            nodes += stats.solve_calls;
+            sweeps += stats.prune_sweeps;
+            Sudoku_AccumulatePropagationStats(&deductions, &stats.propagation);
+            return rc; });
+
+        state.counters["puzzles"] = std::get<3>(result);
+        state.counters["solved"] = std::get<0>(result);
+        state.counters["nodes"] = (double)nodes;
+        state.counters["prune_sweeps"] = (double)sweeps;
+        state.counters["hidden_singles"] = deductions.hidden_singles;
+        state.counters["locked"] = deductions.locked_eliminations;
+        state.counters["subsets"] = deductions.subset_eliminations;
+        state.counters["fish"] = deductions.fish_eliminations;
+
+        ResetMaxLevel();
+        ResetSolveCalls();
+    }
+}
+
+static int register_propagation_benchmarks = []()
+{
+    static const char *const names[] = {"Singles", "Hidden", "Locked", "Subsets", "Fish"};
+
+    for (unsigned int level = SUDOKU_PROPAGATE_SINGLES; level <= SUDOKU_PROPAGATE_FISH; level++)
+    {
+        for (size_t f = 0; f < testFileNames.size(); f++)
+        {
+            std::string name = std::string("Sudoku_Propagation/") + names[level] + "_Puzzles" + std::to_string(f);
+            benchmark::RegisterBenchmark(name.c_str(), Sudoku_Propagation, testFileNames[f], (Sudoku_Propagation_T)level)
+                ->Unit(benchmark::kMillisecond)
+                ->Iterations(1);
+        }
+    }
+    return 0;
+}();
+
+/**
+ * @brief Nodes against time of failed-candidate probing, by probe budget per node.
+ *
+ * Probing bivalue cells removes candidates that branching would only refute after a subtree,
+ * at the cost of two propagations per probed cell. Registered for plain pruning and for
+ * locked candidates, a range of budgets and every dataset; excluded from the default test run.
+ */
+static void Sudoku_Probing(benchmark::State &state, std::string file_name, Sudoku_Propagation_T level, unsigned int budget)
+{
+    for (auto _ : state)
+    {
+        unsigned long nodes = 0;
+        unsigned long probes = 0;
+        unsigned long eliminations = 0;
+
+        auto result = Process_File(file_name, [&](SudokuPuzzle &p)
+                                   {
+            SudokuSolveOptions options;
+            SudokuSolveStats stats = {};
+            options.propagation = level;
+            options.probe_budget = budget;
+            auto rc = p.Solve(options, &stats);
+            nodes += stats.solve_calls;
+            probes += stats.propagation.probes;
+            eliminations += stats.propagation.probe_eliminations;
+            return rc; });
+
+        state.counters["puzzles"] = std::get<3>(result);
+        state.counters["solved"] = std::get<0>(result);
+        state.counters["nodes"] = (double)nodes;
+        state.counters["probes"] = (double)probes;
+        state.counters["probe_eliminations"] = (double)eliminations;
+
+        ResetMaxLevel();
+        ResetSolveCalls();
+    }
+}
+
+static int register_probing_benchmarks = []()
+{
+    for (auto level : {SUDOKU_PROPAGATE_SINGLES, SUDOKU_PROPAGATE_LOCKED})
+    {
+        for (unsigned int budget : {0u, 8u, 32u, 128u})
+        {
+            for (size_t f = 0; f < testFileNames.size(); f++)
+            {
+                std::string name = std::string("Sudoku_Probing/") + ((SUDOKU_PROPAGATE_SINGLES == level) ? "Singles" : "Locked") +
+                                   "_Budget" + std::to_string(budget) + "_Puzzles" + std::to_string(f);
+                benchmark::RegisterBenchmark(name.c_str(), Sudoku_Probing, testFileNames[f], level, budget)
+                    ->Unit(benchmark::kMillisecond)
+                    ->Iterations(1);
+            }
+        }
+    }
+    return 0;
+}();
+
+/**
+ * @brief Node count tail of a dataset, solved without and with randomized restarts.
+ *
+ * Restarts trade a few more nodes on typical puzzles for a shorter tail on the hard ones,
+ * so the counters report node percentiles rather than only the sum. With a transposition
+ * table, later runs refute the states earlier runs proved dead. Excluded from the default
+ * test run.
+ */
+static void Sudoku_Restart(benchmark::State &state, std::string file_name, SudokuRestartSchedule_T schedule, bool restarts, bool use_table)
+{
+    for (auto _ : state)
+    {
+        SudokuTranspositionTable table(18);
+        std::vector<unsigned long> nodes;
+        unsigned long runs = 0;
+        unsigned long probes = 0;
+        unsigned long hits = 0;
+
+        auto result = Process_File(file_name, [&](SudokuPuzzle &p)
+                                   {
+            SudokuRestartOptions options;
+            SudokuRestartStats stats;
+            options.solve.config.seed = 1;
+            options.schedule = schedule;
+            options.max_restarts = restarts ? 0 : 1;
+            options.base_nodes = restarts ? options.base_nodes : ULONG_MAX / 2;
+            options.solve.table = use_table ? &table : nullptr;
+            auto rc = p.SolveWithRestarts(options, &stats);
+            nodes.push_back(stats.total.solve_calls);
+            runs += stats.runs.size();
+            probes += stats.total.table_probes;
+            hits += stats.total.table_hits;
+            return rc; });
+
+        std::sort(nodes.begin(), nodes.end());
+        auto percentile = [&](double q)
+        { return nodes.empty() ? 0.0 : (double)nodes[(size_t)(q * (double)(nodes.size() - 1))]; };
+
+        state.counters["puzzles"] = std::get<3>(result);
+        state.counters["solved"] = std::get<0>(result);
+        state.counters["runs"] = (double)runs;
+        state.counters["nodes_p50"] = percentile(0.5);
+        state.counters["nodes_p99"] = percentile(0.99);
+        state.counters["nodes_p999"] = percentile(0.999);
+        state.counters["nodes_max"] = percentile(1.0);
+        state.counters["table_hit_rate"] = (0 == probes) ? 0.0 : (double)hits / (double)probes;
+
+        ResetMaxLevel();
+        ResetSolveCalls();
+    }
+}
+
+/**
+ * @brief Cost of calling the heuristic through the function table instead of an inlined policy.
+ */
+template <class Policy>
+static void Sudoku_Heuristic_Dispatch(benchmark::State &state, Policy policy)
+{
+    for (auto _ : state)
+    {
+        (void)Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                           { return p.SolveWith(policy); });
+    }
+}
+
+/**
+ * @brief Edit-to-feedback latency of an interactive session.
+ *
+ * Each iteration places a digit, asks for solvability and uniqueness and erases it again,
+ * alternating between the correct digit (answered from the cached solution) and a wrong one.
+ */
+static void Sudoku_Session_Edit(benchmark::State &state)
+{
+    SudokuSession session(validTestPuzzles[3]);
+    SudokuPuzzle solved(validTestPuzzles[3]);
+    (void)solved.Solve();
+
+    Sudoku_Values_T correct = solved.GetValue(0, 0);
+    Sudoku_Values_T wrong = (SUDOKU_VALUE_9 == correct) ? SUDOKU_VALUE_1 : (Sudoku_Values_T)(correct + 1);
+    unsigned long n = 0;
+
+    for (auto _ : state)
+    {
+        (void)session.Place(0, 0, (0 == (n++ % 2)) ? correct : wrong);
+        benchmark::DoNotOptimize(session.IsUnique());
+        (void)session.Erase(0, 0);
+        benchmark::DoNotOptimize(session.IsSolvable());
+    }
+
+    state.counters["searches"] = (double)session.Searches();
+}
+
+/**
+ * @brief Latency of a single hint request.
+ *
+ * The puzzle is first advanced with singles until the cheapest deduction is a more expensive
+ * technique, so that the whole search order is measured.
+ */
+static void Sudoku_Next_Hint(benchmark::State &state)
+{
+    SudokuPuzzle p("4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......");
+    Sudoku_Hint_T hint;
+
+    while ((SUDOKU_RC_SUCCESS == p.NextHint(hint)) && (hint.technique <= SUDOKU_HINT_HIDDEN_SINGLE) && (SUDOKU_HINT_NONE != hint.technique))
+    {
+        (void)p.ApplyHint(hint);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(p.NextHint(hint));
+    }
+
+    state.SetLabel(Sudoku_HintName(hint.technique));
+}
+
+/**
+ * @brief Loads a dataset into a vector of puzzles.
+ *
+ * The vector grows without reserve, so relocations move every puzzle loaded so far.
+ */
+static void Sudoku_Puzzle_Vector(benchmark::State &state, std::string file_name)
+{
+    std::vector<std::string> lines;
+    std::ifstream file(file_name);
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        if (NUM_ROWS * NUM_COLS == line.length())
+        {
+            lines.push_back(line);
+        }
+    }
+
+    for (auto _ : state)
+    {
+        std::vector<SudokuPuzzle> puzzles;
+
+        for (const auto &x : lines)
+        {
+            puzzles.emplace_back(x);
+        }
+        benchmark::DoNotOptimize(puzzles.data());
+    }
+
+    state.counters["puzzles"] = (double)lines.size();
+    state.counters["bytes_per_puzzle"] = (double)sizeof(SudokuPuzzle);
+}
+
+/**
+ * @brief Reads, parses and solves a dataset per iteration through Process_File() on the thread's arena.
+ *
+ * The first iteration grows the arena; every later one must not call the global allocator,
+ * neither for arena chunks nor for anything else, otherwise the benchmark fails.
+ */
+static void Sudoku_Arena_Batch(benchmark::State &state, std::string file_name)
+{
+    SudokuArena &arena = SudokuArena::ThreadLocal();
+    int8_t values[NUM_ROWS * NUM_COLS];
+    const std::function<Sudoku_RC_T(SudokuPuzzle &)> solve = [&values](SudokuPuzzle &p)
+    {
+        Sudoku_RC_T rc = p.Solve();
+        (void)p.GetValues(values);
+        benchmark::DoNotOptimize(values);
+        return rc;
+    };
+    size_t warm_allocations = 0;
+    size_t warm_chunks = 0;
+    unsigned int n_puzzles = 0;
+    bool warm = false;
+
+    for (auto _ : state)
+    {
+        const size_t allocations = global_allocations.load(std::memory_order_relaxed);
+        const size_t chunks = arena.UpstreamAllocations();
+
+        n_puzzles = std::get<3>(Process_File(file_name, arena, solve));
+
+        warm_allocations += warm ? global_allocations.load(std::memory_order_relaxed) - allocations : 0;
+        warm_chunks += warm ? arena.UpstreamAllocations() - chunks : 0;
+        warm = true;
+    }
+
+    state.counters["puzzles"] = (double)n_puzzles;
+    state.counters["warm_allocations"] = (double)warm_allocations;
+    state.counters["warm_chunks"] = (double)warm_chunks;
+    state.counters["arena_chunks"] = (double)arena.UpstreamAllocations();
+
+    if (0 != warm_allocations)
+    {
+        state.SkipWithError("warmed-up batch called the global allocator");
+    }
+
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+/**
+ * @brief Solves a dataset with K interleaved searches per thread, K = state.range(0).
+ *
+ * K = 1 solves the puzzles one after the other with the same search, as the baseline. A search node
+ * works on state that stays in the L1 cache, and no K > 1 has beaten the baseline, so the library
+ * solves batches sequentially; the sweep is kept to re-check this on other data and machines.
+ */
+static void Sudoku_Interleaved(benchmark::State &state, std::string file_name)
+{
+    std::vector<struct SudokuPuzzle_S> givens;
+    std::ifstream file(file_name);
+    std::string line;
+    struct SudokuPuzzle_S p;
+
+    while (std::getline(file, line))
+    {
+        if ((NUM_ROWS * NUM_COLS == line.length()) && (SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, line.c_str())))
+        {
+            givens.push_back(p);
+        }
+    }
+
+    std::vector<struct SudokuPuzzle_S> puzzles;
+    Sudoku_Stats_T stats = {};
+
+    for (auto _ : state)
+    {
+        puzzles = givens;
+        benchmark::DoNotOptimize(Solve_Interleaved(puzzles, (unsigned int)state.range(0), stats));
+    }
+
+    state.counters["puzzles"] = (double)givens.size();
+    state.counters["solve_calls"] = (double)stats.solve_calls;
+    state.counters["puzzles_per_second"] = benchmark::Counter((double)givens.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Relabels the digits, transposes the grid and rotates the bands of a puzzle.
+ */
+static std::string Sudoku_Cache_Copy(const std::string &puzzle, unsigned int shift)
+{
+    std::string copy(NUM_ROWS * NUM_COLS, '.');
+
+    for (unsigned int row = 0; row < NUM_ROWS; row++)
+    {
+        for (unsigned int col = 0; col < NUM_COLS; col++)
+        {
+            char c = puzzle[col * NUM_COLS + row];
+            unsigned int band_row = (row + NUM_SUBGRID_ROWS * shift) % NUM_ROWS;
+
+            copy[band_row * NUM_COLS + col] = (c >= '1' && c <= '9') ? (char)('1' + '9' - c) : '.';
+        }
+    }
+
+    return copy;
+}
+
+/**
+ * @brief Solves a dataset in which state.range(0) percent of the puzzles are symmetric copies
+ *        of earlier ones, through a solution cache if state.range(1) is set.
+ *
+ * Compares the cost of canonicalizing every puzzle with the searches saved by the hits.
+ * Excluded from the default test run.
+ */
+static void Sudoku_Solution_Cache(benchmark::State &state, std::string file_name)
+{
+    std::vector<std::string> lines;
+    std::vector<std::string> puzzles;
+    std::ifstream file(file_name);
+    std::string line;
+    const unsigned int repeat_percent = (unsigned int)state.range(0);
+    const bool use_cache = (0 != state.range(1));
+
+    while (std::getline(file, line))
+    {
+        if (NUM_ROWS * NUM_COLS == line.length())
+        {
+            lines.push_back(line);
+        }
+    }
+
+    /* Every puzzle of the dataset once, followed by copies of earlier ones up to the repeat share */
+    for (size_t i = 0, copies = 0; i < lines.size(); i++)
+    {
+        puzzles.push_back(lines[i]);
+
+        while (100 * copies < repeat_percent * puzzles.size())
+        {
+            puzzles.push_back(Sudoku_Cache_Copy(lines[(copies * 7919) % (i + 1)], (unsigned int)copies));
+            copies++;
+        }
+    }
+
+    SudokuSolutionCache cache;
+
+    for (auto _ : state)
+    {
+        cache.Clear();
+
+        for (const auto &x : puzzles)
+        {
+            SudokuPuzzle p(x);
+            benchmark::DoNotOptimize(use_cache ? cache.Solve(p) : p.Solve());
+        }
+    }
+
+    state.counters["puzzles"] = (double)puzzles.size();
+    state.counters["hit_rate"] = (double)cache.Hits() / (double)puzzles.size();
+    state.counters["puzzles_per_second"] = benchmark::Counter((double)puzzles.size(), benchmark::Counter::kIsIterationInvariantRate);
+
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
 BENCHMARK(Sudoku_Puzzles0)->Unit(benchmark::kSecond)->Iterations(1)->Repetitions(1);
 // BENCHMARK(Sudoku_Puzzles1)->Unit(benchmark::kSecond)->Iterations(1)->Repetitions(1);
 // BENCHMARK(Sudoku_Puzzles2)->Unit(benchmark::kSecond)->Iterations(1)->Repetitions(1);
 BENCHMARK(Sudoku_Puzzles3)->Unit(benchmark::kSecond)->Iterations(1)->Repetitions(3);
 BENCHMARK(Sudoku_Puzzles6)->Unit(benchmark::kSecond)->Iterations(1)->Repetitions(3);
 
+BENCHMARK(Sudoku_Session_Edit)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Sudoku_Next_Hint)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(Sudoku_Puzzle_Vector, Puzzles3, testFileNames[3])->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(Sudoku_Arena_Batch, Puzzles3, testFileNames[3])->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Sudoku_Interleaved, Puzzles1, testFileNames[1])->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Sudoku_Solution_Cache, Puzzles0, testFileNames[0])->ArgsProduct({{0, 10, 25, 50}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Sudoku_Solution_Cache, Puzzles3, testFileNames[3])->ArgsProduct({{0, 10, 25, 50}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles0, testFileNames[0], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles0, testFileNames[0], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles0, testFileNames[0], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles1, testFileNames[1], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles1, testFileNames[1], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles1, testFileNames[1], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles2, testFileNames[2], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles2, testFileNames[2], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles2, testFileNames[2], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles3, testFileNames[3], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles3, testFileNames[3], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles3, testFileNames[3], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles4, testFileNames[4], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles4, testFileNames[4], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles4, testFileNames[4], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles5, testFileNames[5], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles5, testFileNames[5], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles5, testFileNames[5], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles6, testFileNames[6], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles6, testFileNames[6], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles6, testFileNames[6], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles7, testFileNames[7], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles7, testFileNames[7], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles7, testFileNames[7], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Prune_Puzzles8, testFileNames[8], SUDOKU_ENGINE_PRUNE)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, DLX_Puzzles8, testFileNames[8], SUDOKU_ENGINE_DLX)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Engine, Backjump_Puzzles8, testFileNames[8], SUDOKU_ENGINE_BACKJUMP)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK_CAPTURE(Sudoku_Restart, None_Puzzles6, testFileNames[6], SUDOKU_RESTART_LUBY, false, false)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Restart, Luby_Puzzles6, testFileNames[6], SUDOKU_RESTART_LUBY, true, false)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Restart, Geometric_Puzzles6, testFileNames[6], SUDOKU_RESTART_GEOMETRIC, true, false)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Restart, Luby_Table_Puzzles6, testFileNames[6], SUDOKU_RESTART_LUBY, true, true)->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK_CAPTURE(Sudoku_Restart, Geometric_Table_Puzzles6, testFileNames[6], SUDOKU_RESTART_GEOMETRIC, true, true)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK_CAPTURE(Sudoku_Heuristic_Dispatch, Table_Puzzles3, SudokuTablePolicy{&Sudoku_Heuristics[0]})->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK_CAPTURE(Sudoku_Heuristic_Dispatch, Policy_Puzzles3, SudokuWeightedPolicy())->Unit(benchmark::kMillisecond)->Iterations(3);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * @file convert-sudoku.cc
+ * @brief Converts text puzzle datasets (one 81-character puzzle per line) into the binary dataset format.
+ *
+ * Usage: convert-sudoku [--givens] [--solutions] <text file> <binary file>
+ *
+ *  --givens     Use the givens-mask-plus-values encoding instead of 4-bit cells.
+ *  --solutions  Solve every puzzle and attach its solution to the record.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "sudoku.hh"
+#include "sudoku_dataset.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    uint32_t flags = 0;
+    vector<string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "--givens"))
+        {
+            flags |= SUDOKU_DATASET_FLAG_GIVENS;
+        }
+        else if (0 == strcmp(argv[i], "--solutions"))
+        {
+            flags |= SUDOKU_DATASET_FLAG_SOLUTION;
+        }
+        else
+        {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (2 != files.size())
+    {
+        cerr << "Usage: " << argv[0] << " [--givens] [--solutions] <text file> <binary file>" << endl;
+        return 1;
+    }
+
+    ifstream input(files[0]);
+    if (!input)
+    {
+        cerr << "Cannot open " << files[0] << endl;
+        return 1;
+    }
+
+    vector<string> puzzles;
+    unsigned int max_givens = 0;
+    string line;
+
+    while (getline(input, line))
+    {
+        if (81 == line.length())
+        {
+            unsigned int n_givens = 0;
+            for (char c : line)
+            {
+                n_givens += (c >= '1' && c <= '9') ? 1 : 0;
+            }
+
+            max_givens = (n_givens > max_givens) ? n_givens : max_givens;
+            puzzles.push_back(line);
+        }
+    }
+
+    Sudoku_Dataset_T dataset;
+    vector<uint8_t> data(SUDOKU_DATASET_HEADER_SIZE + puzzles.size() * Sudoku_Dataset_RecordSize(flags, max_givens));
+
+    (void)Sudoku_Dataset_WriteHeader(data.data(), flags, puzzles.size(), max_givens);
+    (void)Sudoku_Dataset_Open(&dataset, data.data(), data.size());
+
+    unsigned int unsolved = 0;
+    for (size_t i = 0; i < puzzles.size(); i++)
+    {
+        string solution;
+
+        if (flags & SUDOKU_DATASET_FLAG_SOLUTION)
+        {
+            SudokuPuzzle p(puzzles[i]);
+
+            if (SUDOKU_RC_SUCCESS == p.Solve(SUDOKU_ENGINE_DLX))
+            {
+                solution = p.GetPuzzleAsString();
+            }
+            else
+            {
+                unsolved++;
+            }
+        }
+
+        (void)Sudoku_Dataset_EncodeRecord(&dataset, data.data() + SUDOKU_DATASET_HEADER_SIZE + i * dataset.record_size,
+                                          puzzles[i].c_str(), solution.empty() ? NULL : solution.c_str());
+    }
+
+    ofstream output(files[1], ios::binary);
+    output.write(reinterpret_cast<const char *>(data.data()), (streamsize)data.size());
+    if (!output)
+    {
+        cerr << "Cannot write " << files[1] << endl;
+        return 1;
+    }
+
+    cout << puzzles.size() << " puzzles, " << dataset.record_size << " bytes per record";
+    if (unsolved)
+    {
+        cout << ", " << unsolved << " without solution";
+    }
+    cout << endl;
+
+    return 0;
+}
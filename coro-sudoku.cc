@@ -0,0 +1,137 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest/doctest/doctest.h"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "sudoku.hh"
+#include "sudoku_async.hh"
+#include "sudoku_coro.hh"
+#include "test-sudoku.hh"
+
+using namespace std;
+
+/**
+ * @brief Eagerly started coroutine that fulfils a promise when it returns.
+ */
+struct SudokuTestTask
+{
+    struct promise_type
+    {
+        SudokuTestTask get_return_object(void) { return {}; }
+        suspend_never initial_suspend(void) { return {}; }
+        suspend_never final_suspend(void) noexcept { return {}; }
+        void return_void(void) {}
+        void unhandled_exception(void) { terminate(); }
+    };
+};
+
+/**
+ * @brief Result of an awaited solve and the thread the coroutine continued on.
+ */
+struct SudokuAwaitResult
+{
+    Sudoku_RC_T rc;
+    thread::id resumed_on;
+};
+
+static SudokuTestTask Sudoku_Await(SudokuSolveHandle handle, promise<SudokuAwaitResult> &result)
+{
+    Sudoku_RC_T rc = co_await handle;
+    result.set_value({rc, this_thread::get_id()});
+}
+
+static SudokuTestTask Sudoku_AwaitAll(vector<SudokuSolveHandle> handles, promise<unsigned int> &result)
+{
+    unsigned int n_success = 0;
+
+    for (auto &handle : handles)
+    {
+        n_success += (SUDOKU_RC_SUCCESS == co_await handle) ? 1 : 0;
+    }
+    result.set_value(n_success);
+}
+
+TEST_CASE("Awaited Solve")
+{
+    SUBCASE("Solvable Puzzles")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            promise<SudokuAwaitResult> result;
+            auto handle = SolveAsync(SudokuPuzzle(x));
+            SudokuPuzzle p;
+            SudokuPuzzle p_ref(x);
+
+            (void)Sudoku_Await(handle, result);
+            CHECK(SUDOKU_RC_SUCCESS == result.get_future().get().rc);
+            CHECK(handle.Ready());
+            CHECK(SUDOKU_RC_SUCCESS == handle.Get(p));
+            CHECK(SUDOKU_RC_SUCCESS == p_ref.Solve());
+            CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        }
+    }
+    SUBCASE("Cancellation")
+    {
+        SudokuExecutor executor(1);
+        atomic<bool> release(false);
+        promise<SudokuAwaitResult> result;
+        auto future = result.get_future();
+
+        /* Keep the single worker busy so that the solve is still queued when cancelled */
+        executor.Submit([&]()
+                        { while (!release) { this_thread::yield(); } });
+
+        auto handle = SolveAsync(SudokuPuzzle(validTestPuzzles[3]), SudokuSolveOptions(), executor);
+        (void)Sudoku_Await(handle, result);
+        CHECK(future.wait_for(chrono::milliseconds(10)) == future_status::timeout);
+
+        handle.Cancel();
+        release = true;
+
+        auto awaited = future.get();
+        CHECK(SUDOKU_RC_CANCELLED == awaited.rc);
+        CHECK(this_thread::get_id() != awaited.resumed_on);
+    }
+    SUBCASE("Already completed")
+    {
+        promise<SudokuAwaitResult> result;
+        auto future = result.get_future();
+        auto handle = SolveAsync(SudokuPuzzle(validTestPuzzles[3]));
+
+        CHECK(SUDOKU_RC_SUCCESS == handle.Wait());
+
+        /* Does not suspend: the coroutine has returned before Sudoku_Await() does */
+        (void)Sudoku_Await(handle, result);
+        CHECK(future.wait_for(chrono::seconds(0)) == future_status::ready);
+
+        auto awaited = future.get();
+        CHECK(SUDOKU_RC_SUCCESS == awaited.rc);
+        CHECK(this_thread::get_id() == awaited.resumed_on);
+    }
+    SUBCASE("Many short solves")
+    {
+        /* Solves completing around await_suspend() continue without nesting the coroutine */
+        SudokuExecutor executor(2);
+        SudokuPuzzle solved(validTestPuzzles[3]);
+        vector<SudokuSolveHandle> handles;
+        promise<unsigned int> result;
+
+        CHECK(SUDOKU_RC_SUCCESS == solved.Solve());
+        for (unsigned int i = 0; i < 20000; i++)
+        {
+            handles.push_back(SolveAsync(solved, SudokuSolveOptions(), executor));
+        }
+
+        (void)Sudoku_AwaitAll(handles, result);
+        CHECK(handles.size() == result.get_future().get());
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
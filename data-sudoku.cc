@@ -2,10 +2,29 @@
 #include "doctest/doctest/doctest.h"
 //#include "hayai/src/hayai.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <zlib.h>
 
 #include "sudoku.hh"
+#include "sudoku_arena.hh"
+#include "sudoku_async.hh"
+#include "sudoku_cache.hh"
+#include "sudoku_heuristic.hh"
+#include "sudoku_session.hh"
+#include "sudoku_store.hh"
+#include "sudoku_stream.hh"
+#include "sudoku_telemetry.hh"
+#include "sudoku_transposition.hh"
 #include "test-sudoku.hh"
 
 using namespace std;
@@ -28,6 +47,1594 @@ TEST_CASE("Unsolvable Puzzles")
     }
 }
 
+TEST_CASE("Dancing Links Engine")
+{
+    SUBCASE("Solvable Puzzles")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            SudokuPuzzle p_ref(x);
+            CHECK(SUDOKU_RC_SUCCESS == p.Solve(SUDOKU_ENGINE_DLX));
+            CHECK(SUDOKU_RC_SUCCESS == p.Check());
+            CHECK(SUDOKU_RC_SUCCESS == p_ref.Solve());
+            CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        }
+    }
+    SUBCASE("Unsolvable Puzzles")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_ERROR == p.Solve(SUDOKU_ENGINE_DLX));
+        }
+    }
+}
+
+TEST_CASE("Backjumping Engine")
+{
+    for (auto x : invalidTestPuzzles)
+    {
+        SudokuPuzzle p(x);
+        CHECK(SUDOKU_RC_ERROR == p.Solve(SUDOKU_ENGINE_BACKJUMP));
+    }
+
+    /* Same branching and propagation as the pruning engine, minus the subtrees jumped over */
+    ResetSolveCalls();
+    auto [success, prune, error, count] = Process_File(testFileNames[3]);
+    unsigned int prune_calls = GetSolveCalls();
+    unsigned int backjump_calls = 0;
+    CHECK(count == success);
+
+    ResetSolveCalls();
+    auto [bj_success, bj_prune, bj_error, bj_count] = Process_File(testFileNames[3], [&backjump_calls](SudokuPuzzle &p)
+                                                                   {
+        SudokuPuzzle p_ref(p);
+        unsigned int calls = GetSolveCalls();
+        Sudoku_RC_T rc = p.Solve(SUDOKU_ENGINE_BACKJUMP);
+        backjump_calls += GetSolveCalls() - calls;
+        CHECK(SUDOKU_RC_SUCCESS == p.Check());
+        (void)p_ref.Solve(SUDOKU_ENGINE_PRUNE);
+        CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        return rc; });
+    CHECK(bj_count == bj_success);
+    CHECK(0 == bj_error);
+    CHECK(backjump_calls <= prune_calls);
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Count Solutions")
+{
+    for (auto engine : {SUDOKU_ENGINE_PRUNE, SUDOKU_ENGINE_DLX})
+    {
+        unsigned long count = 0;
+
+        SUBCASE("Unique solution")
+        {
+            SudokuPuzzle p(validTestPuzzles[3]);
+            CHECK(SUDOKU_RC_SUCCESS == p.CountSolutions(count, 10, engine));
+            CHECK(1 == count);
+            CHECK(validTestPuzzles[3].length() == p.GetPuzzleAsString().length());
+            CHECK(SUDOKU_RC_PRUNE == p.Check()); /* Puzzle is left untouched */
+        }
+        SUBCASE("Limited count on an empty grid")
+        {
+            SudokuPuzzle p;
+            CHECK(SUDOKU_RC_SUCCESS == p.CountSolutions(count, 100, engine));
+            CHECK(100 == count);
+        }
+        SUBCASE("Two solutions")
+        {
+            /* Solved grid with an unavoidable rectangle (rows 1 and 3, columns 1 and 7) left open */
+            SudokuPuzzle p(".74236.58638591742.25487.36316754289742918563589362417867125394253649871491873625");
+            CHECK(SUDOKU_RC_SUCCESS == p.CountSolutions(count, 10, engine));
+            CHECK(2 == count);
+        }
+        SUBCASE("No solution")
+        {
+            for (auto x : invalidTestPuzzles)
+            {
+                SudokuPuzzle p(x);
+                CHECK(SUDOKU_RC_ERROR == p.CountSolutions(count, 10, engine));
+                CHECK(0 == count);
+            }
+        }
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Bounded Solve")
+{
+    const std::string hard_puzzle = "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..";
+    SudokuSolveOptions options;
+    SudokuSolveStats stats = {};
+
+    SUBCASE("Node budget")
+    {
+        SudokuPuzzle p(hard_puzzle);
+        options.max_nodes = 1;
+        CHECK(SUDOKU_RC_BUDGET_EXHAUSTED == p.Solve(options, &stats));
+        CHECK(1 == stats.solve_calls);
+        CHECK(SUDOKU_RC_PRUNE == p.Check()); /* Partial state stays consistent */
+
+        /* Resume without budget */
+        CHECK(SUDOKU_RC_SUCCESS == p.Solve());
+        CHECK(SUDOKU_RC_SUCCESS == p.Check());
+    }
+    SUBCASE("Expired deadline")
+    {
+        SudokuPuzzle p(hard_puzzle);
+        options.deadline = std::chrono::steady_clock::now();
+        CHECK(SUDOKU_RC_BUDGET_EXHAUSTED == p.Solve(options, &stats));
+        CHECK(0 == stats.solve_calls);
+    }
+    SUBCASE("Cancel token")
+    {
+        std::atomic<bool> cancel(true);
+        SudokuPuzzle p(hard_puzzle);
+        options.cancel = &cancel;
+        CHECK(SUDOKU_RC_CANCELLED == p.Solve(options, &stats));
+
+        cancel = false;
+        CHECK(SUDOKU_RC_SUCCESS == p.Solve(options, &stats));
+        CHECK(0 < stats.solve_calls);
+    }
+    SUBCASE("Sufficient budget")
+    {
+        SudokuPuzzle p(hard_puzzle);
+        options.max_nodes = 1000000;
+        options.deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        CHECK(SUDOKU_RC_SUCCESS == p.Solve(options, &stats));
+        CHECK(SUDOKU_RC_SUCCESS == p.Check());
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Portfolio Solver")
+{
+    SudokuPortfolioResult result;
+
+    SUBCASE("Solvable Puzzles")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            SudokuPuzzle p_ref(x);
+            CHECK(SUDOKU_RC_SUCCESS == p.SolvePortfolio(result));
+            CHECK(SUDOKU_RC_SUCCESS == result.rc);
+            CHECK(result.winner < SudokuPuzzle::DefaultPortfolio().size());
+            CHECK(0 < result.solve_calls);
+            CHECK(SUDOKU_RC_SUCCESS == p_ref.Solve());
+            CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        }
+    }
+    SUBCASE("Unsolvable Puzzles")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_ERROR == p.SolvePortfolio(result));
+        }
+    }
+    SUBCASE("Single configuration")
+    {
+        const Sudoku_SearchConfig_T config = {SUDOKU_SCORE_MRV, SUDOKU_ORDER_ASCENDING, 42, nullptr};
+        SudokuPuzzle p(validTestPuzzles[3]);
+        CHECK(SUDOKU_RC_SUCCESS == p.SolvePortfolio(result, {config}));
+        CHECK(0 == result.winner);
+        CHECK(SUDOKU_SCORE_MRV == result.config.score);
+        CHECK(42 == result.config.seed);
+    }
+    SUBCASE("Empty portfolio")
+    {
+        SudokuPuzzle p(validTestPuzzles[3]);
+        CHECK(SUDOKU_RC_INVALID_INPUT == p.SolvePortfolio(result, {}));
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+/**
+ * @brief Relabels the digits, transposes the grid and swaps the first and last bands.
+ */
+static string Sudoku_Symmetric_Copy(const string &puzzle)
+{
+    string copy(NUM_ROWS * NUM_COLS, '.');
+
+    for (unsigned int row = 0; row < NUM_ROWS; row++)
+    {
+        for (unsigned int col = 0; col < NUM_COLS; col++)
+        {
+            char c = puzzle[col * NUM_COLS + row];
+            unsigned int band_row = (row + 6) % NUM_ROWS;
+
+            copy[band_row * NUM_COLS + col] = (c >= '1' && c <= '9') ? (char)('1' + '9' - c) : '.';
+        }
+    }
+
+    return copy;
+}
+
+TEST_CASE("Solution Cache")
+{
+    SUBCASE("Canonical form of symmetric copies")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            SudokuPuzzle q(Sudoku_Symmetric_Copy(x));
+            SudokuGridKey p_key, q_key;
+            SudokuTransform p_transform, q_transform;
+
+            CHECK(SUDOKU_RC_SUCCESS == SudokuSolutionCache::Canonicalize(p, p_key, p_transform));
+            CHECK(SUDOKU_RC_SUCCESS == SudokuSolutionCache::Canonicalize(q, q_key, q_transform));
+            CHECK(p_key == q_key);
+        }
+    }
+    SUBCASE("Cached solutions of symmetric copies")
+    {
+        SudokuSolutionCache cache(64, 4);
+
+        for (auto x : validTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            SudokuPuzzle q(Sudoku_Symmetric_Copy(x));
+            SudokuPuzzle q_ref(Sudoku_Symmetric_Copy(x));
+
+            CHECK(SUDOKU_RC_SUCCESS == cache.Solve(p));
+            CHECK(SUDOKU_RC_SUCCESS == cache.Solve(q, SUDOKU_ENGINE_DLX));
+            CHECK(SUDOKU_RC_SUCCESS == q.Check());
+            CHECK(SUDOKU_RC_SUCCESS == q_ref.Solve());
+            CHECK(q_ref.GetPuzzleAsString() == q.GetPuzzleAsString());
+        }
+
+        CHECK(validTestPuzzles.size() == cache.Misses());
+        CHECK(validTestPuzzles.size() == cache.Hits());
+        CHECK(validTestPuzzles.size() == cache.Size());
+
+        cache.Clear();
+        CHECK(0 == cache.Size());
+        CHECK(0 == cache.Hits());
+    }
+    SUBCASE("Unsolvable Puzzles")
+    {
+        SudokuSolutionCache cache;
+
+        for (auto x : invalidTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_ERROR == cache.Solve(p));
+        }
+        CHECK(0 == cache.Size());
+    }
+    SUBCASE("Puzzles with too few clues")
+    {
+        SudokuSolutionCache cache;
+        SudokuPuzzle p(string(NUM_ROWS * NUM_COLS, '.'));
+        SudokuGridKey key;
+        SudokuTransform transform;
+
+        CHECK(SUDOKU_RC_ERROR == SudokuSolutionCache::Canonicalize(p, key, transform));
+        CHECK(SUDOKU_RC_SUCCESS == cache.Solve(p));
+        CHECK(SUDOKU_RC_SUCCESS == p.Check());
+        CHECK(0 == cache.Size());
+        CHECK(0 == cache.Misses());
+    }
+    SUBCASE("Least recently used eviction")
+    {
+        SudokuSolutionCache cache(1, 1);
+
+        for (auto x : validTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_SUCCESS == cache.Solve(p));
+        }
+        CHECK(1 == cache.Size());
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Solution Store")
+{
+    const string store_file = "sudoku-store-test.db";
+    (void)remove(store_file.c_str());
+
+    SUBCASE("Warm restart")
+    {
+        SudokuSolveStats stats;
+        vector<SudokuSolveStats> solved;
+        {
+            SudokuSolutionStore store;
+            CHECK(SUDOKU_RC_SUCCESS == store.Open(store_file, true, 4));
+
+            for (auto x : validTestPuzzles)
+            {
+                SudokuPuzzle p(x);
+                CHECK(SUDOKU_RC_SUCCESS == store.Solve(p, &stats));
+                CHECK(0 < stats.solve_calls);
+                solved.push_back(stats);
+            }
+            for (auto x : invalidTestPuzzles)
+            {
+                SudokuPuzzle p(x);
+                CHECK(SUDOKU_RC_ERROR == store.Solve(p));
+            }
+            CHECK(validTestPuzzles.size() == store.Size());
+            CHECK(0 == store.Hits());
+        }
+
+        SudokuSolutionStore store;
+        CHECK(SUDOKU_RC_SUCCESS == store.Open(store_file, false));
+        CHECK(validTestPuzzles.size() == store.Size());
+
+        for (size_t i = 0; i < validTestPuzzles.size(); i++)
+        {
+            SudokuPuzzle p(validTestPuzzles[i]);
+            SudokuPuzzle p_ref(validTestPuzzles[i]);
+            CHECK(SUDOKU_RC_SUCCESS == store.Solve(p, &stats));
+            CHECK(SUDOKU_RC_SUCCESS == p.Check());
+            CHECK(solved[i].max_level == stats.max_level);
+            CHECK(solved[i].solve_calls == stats.solve_calls);
+            CHECK(solved[i].backtracks == stats.backtracks);
+            CHECK(solved[i].prune_sweeps == stats.prune_sweeps);
+            CHECK(SUDOKU_RC_SUCCESS == p_ref.Solve());
+            CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        }
+        CHECK(validTestPuzzles.size() == store.Hits());
+        CHECK(0 == store.Misses());
+    }
+    SUBCASE("Single writer and concurrent readers")
+    {
+        SudokuSolutionStore writer;
+        SudokuSolutionStore second_writer;
+        SudokuSolutionStore reader;
+        SudokuSolutionStore::Record record;
+        SudokuPackedGrid key;
+
+        CHECK(SUDOKU_RC_SUCCESS == writer.Open(store_file, true, 2));
+        CHECK(SUDOKU_RC_ERROR == second_writer.Open(store_file, true));
+        CHECK(SUDOKU_RC_SUCCESS == reader.Open(store_file, false));
+        CHECK(SUDOKU_RC_ERROR == reader.Erase(key));
+
+        /* The writer outgrows the initial table and replaces the file while the reader has it mapped */
+        for (auto x : validTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_SUCCESS == writer.Solve(p));
+        }
+        CHECK(2 < writer.Capacity());
+        CHECK(validTestPuzzles.size() == reader.Size());
+
+        SudokuPuzzle p(validTestPuzzles[3]);
+        Sudoku_PackGrid(p, key);
+        CHECK(reader.Lookup(key, record));
+        CHECK(SUDOKU_RC_SUCCESS == writer.Erase(key));
+        CHECK(!reader.Lookup(key, record));
+        CHECK(SUDOKU_RC_SUCCESS == writer.Compact());
+        CHECK(validTestPuzzles.size() - 1 == reader.Size());
+        CHECK(!reader.Lookup(key, record));
+
+        /* Records keep the deduction counters of their solve */
+        SudokuSolutionStore::Record inserted = {};
+        inserted.stats.max_level = 7;
+        inserted.stats.backtracks = 11;
+        inserted.stats.propagation.hidden_singles = 13;
+        inserted.stats.propagation.probe_eliminations = 17;
+        CHECK(SUDOKU_RC_SUCCESS == writer.Insert(key, inserted));
+        CHECK(reader.Lookup(key, record));
+        CHECK(7 == record.stats.max_level);
+        CHECK(11 == record.stats.backtracks);
+        CHECK(13 == record.stats.propagation.hidden_singles);
+        CHECK(17 == record.stats.propagation.probe_eliminations);
+    }
+    SUBCASE("Dataset batch")
+    {
+        SudokuSolutionStore store;
+        CHECK(SUDOKU_RC_SUCCESS == store.Open(store_file, true));
+
+        auto [success, prune, error, count] = Process_File(testFileNames[3], store);
+        CHECK(count == success);
+        CHECK(count == store.Hits() + store.Misses());
+        CHECK(store.Size() == store.Misses());
+
+        /* Duplicate puzzles of the dataset are already hits on the first pass */
+        unsigned long hits = store.Hits();
+
+        auto [warm_success, warm_prune, warm_error, warm_count] = Process_File(testFileNames[3], store);
+        CHECK(warm_count == warm_success);
+        CHECK(warm_count == store.Hits() - hits);
+    }
+
+    (void)remove(store_file.c_str());
+    (void)remove((store_file + ".lock").c_str());
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Binary Dataset")
+{
+    const string binary_file = "sudoku-dataset-test.bin";
+    ifstream text_file(testFileNames[3]);
+    vector<string> puzzles;
+    string line;
+
+    while (getline(text_file, line))
+    {
+        if (81 == line.length())
+        {
+            puzzles.push_back(line);
+        }
+    }
+
+    for (uint32_t flags : {(uint32_t)0, SUDOKU_DATASET_FLAG_GIVENS})
+    {
+        Sudoku_Dataset_T dataset;
+        vector<uint8_t> data(SUDOKU_DATASET_HEADER_SIZE + puzzles.size() * Sudoku_Dataset_RecordSize(flags, 81));
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_WriteHeader(data.data(), flags, puzzles.size(), 81));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_Open(&dataset, data.data(), data.size()));
+        for (size_t i = 0; i < puzzles.size(); i++)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_EncodeRecord(&dataset, data.data() + SUDOKU_DATASET_HEADER_SIZE + i * dataset.record_size, puzzles[i].c_str(), NULL));
+        }
+
+        ofstream(binary_file, ios::binary).write(reinterpret_cast<const char *>(data.data()), (streamsize)data.size());
+
+        auto [text_success, text_prune, text_error, text_count] = Process_File(testFileNames[3]);
+        unsigned int text_solve_calls = GetSolveCalls();
+        ResetSolveCalls();
+
+        auto [success, prune, error, count] = Process_Binary_File(binary_file);
+        CHECK(text_count == count);
+        CHECK(text_success == success);
+        CHECK(text_solve_calls == GetSolveCalls());
+        ResetSolveCalls();
+
+        /* Random access */
+        if (!puzzles.empty())
+        {
+            SudokuPuzzle p;
+            SudokuPuzzle p_ref(puzzles.back());
+            CHECK(SUDOKU_RC_SUCCESS == p.InitializePuzzle(dataset, puzzles.size() - 1));
+            CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        }
+    }
+
+    (void)remove(binary_file.c_str());
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Compressed Dataset")
+{
+    const string compressed_file = "sudoku-dataset-test.gz";
+    ifstream text_file(testFileNames[3]);
+    string text((istreambuf_iterator<char>(text_file)), istreambuf_iterator<char>());
+
+    gzFile file = gzopen(compressed_file.c_str(), "wb");
+    REQUIRE(nullptr != file);
+    CHECK((int)text.size() == gzwrite(file, text.data(), (unsigned int)text.size()));
+    CHECK(Z_OK == gzclose(file));
+
+    auto [text_success, text_prune, text_error, text_count] = Process_File(testFileNames[3]);
+    unsigned int text_solve_calls = GetSolveCalls();
+    ResetSolveCalls();
+
+    SUBCASE("Decompression overlaps with solver workers")
+    {
+        for (unsigned int n_workers : {1, 4})
+        {
+            auto [success, prune, error, count] = Process_Compressed_File(compressed_file, n_workers);
+            CHECK(text_count == count);
+            CHECK(text_success == success);
+            CHECK(text_error == error);
+            CHECK(text_solve_calls == GetSolveCalls());
+            ResetSolveCalls();
+        }
+    }
+    SUBCASE("Plain text input")
+    {
+        auto [success, prune, error, count] = Process_Compressed_File(testFileNames[3], 2);
+        CHECK(text_count == count);
+        CHECK(text_success == success);
+    }
+    SUBCASE("Small bounded buffers")
+    {
+        SudokuPuzzleStream stream(3, 1);
+        vector<string> batch;
+        unsigned long n = 0;
+
+        CHECK(SUDOKU_RC_SUCCESS == stream.Open(compressed_file));
+        while (stream.Next(batch))
+        {
+            CHECK(batch.size() <= 3);
+            n += batch.size();
+        }
+        CHECK(text_count == n);
+        CHECK(text_count == stream.Count());
+        CHECK(SUDOKU_RC_SUCCESS == stream.Status());
+    }
+    SUBCASE("Truncated file")
+    {
+        string compressed;
+        {
+            ifstream in(compressed_file, ios::binary);
+            compressed.assign((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        }
+        ofstream(compressed_file, ios::binary | ios::trunc).write(compressed.data(), (streamsize)compressed.size() / 2);
+
+        SudokuPuzzleStream stream;
+        vector<string> batch;
+
+        CHECK(SUDOKU_RC_SUCCESS == stream.Open(compressed_file));
+        while (stream.Next(batch))
+        {
+        }
+        CHECK(SUDOKU_RC_ERROR == stream.Status());
+    }
+    SUBCASE("Missing file")
+    {
+        SudokuPuzzleStream stream;
+        CHECK(SUDOKU_RC_ERROR == stream.Open("missing-dataset.gz"));
+    }
+
+    (void)remove(compressed_file.c_str());
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Asynchronous Solve")
+{
+    SUBCASE("Solvable Puzzles")
+    {
+        vector<SudokuSolveHandle> handles;
+
+        for (auto x : validTestPuzzles)
+        {
+            handles.push_back(SolveAsync(SudokuPuzzle(x)));
+        }
+
+        for (size_t i = 0; i < handles.size(); i++)
+        {
+            SudokuPuzzle p;
+            SudokuPuzzle p_ref(validTestPuzzles[i]);
+            CHECK(SUDOKU_RC_SUCCESS == handles[i].Get(p));
+            CHECK(handles[i].Ready());
+            CHECK(0 < handles[i].Stats().solve_calls);
+            CHECK(SUDOKU_RC_SUCCESS == p_ref.Solve());
+            CHECK(p_ref.GetPuzzleAsString() == p.GetPuzzleAsString());
+        }
+    }
+    SUBCASE("Unsolvable Puzzles")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_ERROR == SolveAsync(SudokuPuzzle(x)).Wait());
+        }
+    }
+    SUBCASE("Completion callbacks")
+    {
+        SudokuExecutor executor(2);
+        atomic<unsigned int> completed(0);
+        atomic<bool> solved(false);
+
+        auto handle = SolveAsync(SudokuPuzzle(validTestPuzzles[3]), SudokuSolveOptions(), executor);
+        handle.Then([&](Sudoku_RC_T rc, const SudokuPuzzle &p)
+                    { SudokuPuzzle q(p); solved = (SUDOKU_RC_SUCCESS == rc) && (SUDOKU_RC_SUCCESS == q.Check()); completed++; });
+        CHECK(SUDOKU_RC_SUCCESS == handle.Wait());
+
+        /* Registered after completion: runs on the calling thread */
+        handle.Then([&](Sudoku_RC_T, const SudokuPuzzle &)
+                    { completed++; });
+        CHECK(handle.WaitFor(chrono::seconds(10)));
+        while (completed < 2)
+        {
+            this_thread::yield();
+        }
+        CHECK(solved);
+    }
+    SUBCASE("Cancellation")
+    {
+        SudokuExecutor executor(1);
+        atomic<bool> release(false);
+
+        /* Keep the single worker busy so that the solve is still queued when cancelled */
+        executor.Submit([&]()
+                        { while (!release) { this_thread::yield(); } });
+
+        auto handle = SolveAsync(SudokuPuzzle("8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4.."), SudokuSolveOptions(), executor);
+        CHECK(!handle.WaitFor(chrono::milliseconds(10)));
+        handle.Cancel();
+        release = true;
+        CHECK(SUDOKU_RC_CANCELLED == handle.Wait());
+        CHECK(0 == handle.Stats().solve_calls);
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Branching Heuristics")
+{
+    for (unsigned int h = 0; h < Sudoku_NumHeuristics; h++)
+    {
+        const Sudoku_Heuristic_T &heuristic = Sudoku_Heuristics[h];
+        unsigned long nodes = 0;
+
+        auto [success, prune, error, count] = Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                                                           {
+            SudokuPuzzle q(p);
+            SudokuSolveStats stats = {};
+            SudokuSolveStats policy_stats = {};
+            Sudoku_RC_T rc = p.Solve(heuristic, &stats);
+            Sudoku_RC_T policy_rc = SUDOKU_RC_ERROR;
+
+            /* Policies make the same decisions as the tables */
+            switch (h)
+            {
+            case 0:
+                policy_rc = q.SolveWith(SudokuWeightedPolicy(), &policy_stats);
+                break;
+            case 1:
+                policy_rc = q.SolveWith(SudokuMRVPolicy(), &policy_stats);
+                break;
+            case 2:
+                policy_rc = q.SolveWith(SudokuUnitPolicy(), &policy_stats);
+                break;
+            case 3:
+                policy_rc = q.SolveWith(SudokuBivaluePolicy(), &policy_stats);
+                break;
+            default:
+                policy_rc = q.SolveWith(SudokuLCVPolicy(), &policy_stats);
+                break;
+            }
+
+            CHECK(rc == policy_rc);
+            CHECK(stats.solve_calls == policy_stats.solve_calls);
+            CHECK(p.GetPuzzleAsString() == q.GetPuzzleAsString());
+            CHECK(SUDOKU_RC_SUCCESS == p.Check());
+            nodes += stats.solve_calls;
+
+            return rc; });
+
+        CHECK(count == success);
+        CHECK(0 == error);
+        CHECK(0 < nodes);
+    }
+
+    /* The weighted heuristic takes the decisions of the default engine */
+    ResetSolveCalls();
+    (void)Process_File(testFileNames[3]);
+    unsigned int default_calls = GetSolveCalls();
+    ResetSolveCalls();
+    (void)Process_File(testFileNames[3], [](SudokuPuzzle &p)
+                       { return p.Solve(Sudoku_Heuristics[0]); });
+    CHECK(default_calls == GetSolveCalls());
+
+    /* Policies search with the options of the common search */
+    SudokuSolveOptions options;
+    SudokuSolveStats stats = {};
+    SudokuSolveStats policy_stats = {};
+    std::atomic<bool> cancel(true);
+
+    options.max_nodes = 1;
+    CHECK(SUDOKU_RC_BUDGET_EXHAUSTED == SudokuPuzzle().SolveWith(SudokuLCVPolicy(), options, &stats));
+    CHECK(1 == stats.solve_calls);
+
+    options.max_nodes = 0;
+    options.cancel = &cancel;
+    CHECK(SUDOKU_RC_CANCELLED == SudokuPuzzle().SolveWith(SudokuLCVPolicy(), options));
+
+    options.cancel = nullptr;
+    options.propagation = SUDOKU_PROPAGATE_FISH;
+    options.config.heuristic = Sudoku_FindHeuristic("mrv-lcv");
+    (void)Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                       {
+        SudokuPuzzle q(p);
+        Sudoku_RC_T rc = p.Solve(options, &stats);
+
+        CHECK(rc == q.SolveWith(SudokuLCVPolicy(), options, &policy_stats));
+        CHECK(stats.solve_calls == policy_stats.solve_calls);
+        CHECK(stats.propagation.hidden_singles == policy_stats.propagation.hidden_singles);
+        CHECK(p.GetPuzzleAsString() == q.GetPuzzleAsString());
+
+        return rc; });
+
+    /* Seeded ties are broken alike by the configuration, the table and the policy */
+    options.propagation = SUDOKU_PROPAGATE_SINGLES;
+    options.config = {SUDOKU_SCORE_MRV, SUDOKU_ORDER_ASCENDING, 0x2545F491u, nullptr};
+    (void)Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                       {
+        SudokuPuzzle q(p);
+        SudokuPuzzle r(p);
+        SudokuSolveOptions table_options = options;
+        SudokuSolveStats table_stats = {};
+        Sudoku_RC_T rc = p.Solve(options, &stats);
+
+        table_options.config.heuristic = Sudoku_FindHeuristic("mrv");
+        CHECK(rc == q.Solve(table_options, &table_stats));
+        CHECK(rc == r.SolveWith(SudokuMRVPolicy(), options, &policy_stats));
+        CHECK(stats.solve_calls == table_stats.solve_calls);
+        CHECK(stats.solve_calls == policy_stats.solve_calls);
+        CHECK(p.GetPuzzleAsString() == r.GetPuzzleAsString());
+
+        return rc; });
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Randomized Restarts")
+{
+    SudokuRestartOptions luby;
+    SudokuRestartOptions geometric;
+    geometric.schedule = SUDOKU_RESTART_GEOMETRIC;
+    geometric.base_nodes = 10;
+    geometric.factor = 2.0;
+
+    const unsigned long luby_sequence[] = {1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, 1};
+    for (unsigned int run = 0; run < sizeof(luby_sequence) / sizeof(luby_sequence[0]); run++)
+    {
+        CHECK(luby.base_nodes * luby_sequence[run] == SudokuPuzzle::RestartLimit(luby, run));
+    }
+    CHECK(10 == SudokuPuzzle::RestartLimit(geometric, 0));
+    CHECK(80 == SudokuPuzzle::RestartLimit(geometric, 3));
+
+    /* Short runs force restarts, the run after the last restart completes the search */
+    SudokuRestartOptions options;
+    options.solve.config.seed = 42;
+    options.base_nodes = 2;
+    options.max_restarts = 3;
+
+    unsigned long restarts = 0;
+    auto [success, prune, error, count] = Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                                                       {
+        SudokuPuzzle q(p);
+        SudokuRestartStats stats;
+        SudokuRestartStats replay;
+        Sudoku_RC_T rc = p.SolveWithRestarts(options, &stats);
+
+        /* Same seed, same runs */
+        CHECK(rc == q.SolveWithRestarts(options, &replay));
+        CHECK(p.GetPuzzleAsString() == q.GetPuzzleAsString());
+        CHECK(stats.runs.size() == replay.runs.size());
+        CHECK(0 < stats.runs.size());
+        CHECK(stats.runs.size() <= options.max_restarts + 1);
+        if (stats.runs.empty() || (stats.runs.size() != replay.runs.size()))
+        {
+            return SUDOKU_RC_ERROR;
+        }
+
+        unsigned int calls = 0;
+        for (size_t run = 0; run < stats.runs.size(); run++)
+        {
+            CHECK(stats.runs[run].seed == replay.runs[run].seed);
+            CHECK(stats.runs[run].stats.solve_calls == replay.runs[run].stats.solve_calls);
+            CHECK(stats.runs[run].stats.backtracks == replay.runs[run].stats.backtracks);
+            CHECK(((run + 1 == stats.runs.size()) || (SUDOKU_RC_BUDGET_EXHAUSTED == stats.runs[run].rc)));
+            calls += stats.runs[run].stats.solve_calls;
+        }
+        CHECK(SUDOKU_RC_BUDGET_EXHAUSTED != stats.runs.back().rc);
+        CHECK(calls == stats.total.solve_calls);
+        restarts += stats.runs.size() - 1;
+
+        return rc; });
+
+    CHECK(count == success);
+    CHECK(0 == error);
+    CHECK(0 < restarts);
+
+    /* The overall node budget bounds all runs together */
+    SudokuPuzzle p(validTestPuzzles[3]);
+    SudokuRestartStats stats;
+    options.solve.max_nodes = 5;
+    options.max_restarts = 0;
+    CHECK(SUDOKU_RC_BUDGET_EXHAUSTED == p.SolveWithRestarts(options, &stats));
+    CHECK(5 == stats.total.solve_calls);
+    options.solve.max_nodes = 0;
+    CHECK(SUDOKU_RC_SUCCESS == p.SolveWithRestarts(options, &stats));
+    CHECK(SUDOKU_RC_SUCCESS == p.Check());
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Transposition Table")
+{
+    SudokuTranspositionTable table(10);
+    uint64_t count = 1;
+
+    CHECK(1024 == table.Capacity());
+    CHECK(!table.Probe(0x1234, count));
+    table.Store(0x1234, 7);
+    CHECK(table.Probe(0x1234, count));
+    CHECK(7 == count);
+    CHECK(!table.IsDead(0x1234));
+    CHECK(!table.Probe(0x1234 + table.Capacity(), count)); /* Same slot, other key */
+    table.Store(0x1234 + table.Capacity(), 0);
+    CHECK(table.IsDead(0x1234 + table.Capacity()));
+    CHECK(!table.Probe(0x1234, count)); /* Replaced */
+    table.Store(0, 0);
+    CHECK(!table.IsDead(0));
+    table.Clear();
+    CHECK(!table.IsDead(0x1234 + table.Capacity()));
+
+    /* A second solve of the same puzzles refutes the branches the first one proved dead */
+    SudokuTranspositionTable dead_states;
+    SudokuSolveOptions options;
+    options.table = &dead_states;
+    unsigned long hits = 0;
+
+    auto [success, prune, error, n] = Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                                                   {
+        SudokuPuzzle q(p);
+        SudokuPuzzle r(p);
+        SudokuSolveStats first = {};
+        SudokuSolveStats second = {};
+        Sudoku_RC_T rc = p.Solve(options, &first);
+
+        CHECK(rc == q.Solve(options, &second));
+        CHECK(SUDOKU_RC_SUCCESS == r.Solve());
+        CHECK(p.GetPuzzleAsString() == r.GetPuzzleAsString());
+        CHECK(q.GetPuzzleAsString() == r.GetPuzzleAsString());
+        CHECK(second.solve_calls <= first.solve_calls);
+        CHECK(second.table_hits <= second.table_probes);
+        hits += second.table_hits;
+
+        return rc; });
+
+    CHECK(n == success);
+    CHECK(0 == error);
+    CHECK(0 < hits);
+
+    /* Portfolio threads share the table */
+    SudokuPortfolioResult result;
+    SudokuPuzzle p(validTestPuzzles[3]);
+    CHECK(SUDOKU_RC_SUCCESS == p.SolvePortfolio(result, SudokuPuzzle::DefaultPortfolio(), &dead_states));
+    CHECK(SUDOKU_RC_SUCCESS == p.Check());
+
+    /* Subtree counts: same count with and without the table, fewer nodes once the table is filled */
+    SudokuTranspositionTable subtrees;
+    for (auto limit : {1000ul, 10ul})
+    {
+        SudokuPuzzle empty_band("000000000000000000000000000316754289742918563589362417867125394253649871491873625");
+        unsigned long plain = 0;
+        unsigned long cached = 0;
+
+        CHECK(SUDOKU_RC_SUCCESS == empty_band.CountSolutions(plain, limit));
+        CHECK(SUDOKU_RC_SUCCESS == empty_band.CountSolutions(cached, limit, SUDOKU_ENGINE_PRUNE, &subtrees));
+        CHECK(plain == cached);
+
+        ResetSolveCalls();
+        CHECK(SUDOKU_RC_SUCCESS == empty_band.CountSolutions(cached, limit, SUDOKU_ENGINE_PRUNE, &subtrees));
+        CHECK(plain == cached);
+        CHECK(1 == GetSolveCalls());
+        CHECK(SUDOKU_RC_PRUNE == empty_band.Check());
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Solve Telemetry")
+{
+    auto [text_success, text_prune, text_error, text_count] = Process_File(testFileNames[3]);
+    unsigned int text_solve_calls = GetSolveCalls();
+    ResetSolveCalls();
+
+    SUBCASE("CSV")
+    {
+        stringstream out;
+        SudokuTelemetry telemetry(out, SudokuTelemetryFormat::CSV);
+
+        auto [success, prune, error, count] = Process_File(testFileNames[3], telemetry);
+        CHECK(text_count == count);
+        CHECK(text_success == success);
+        CHECK(0 == telemetry.Count());
+
+        string line;
+        unsigned long n_records = 0;
+        unsigned long n_histograms = 0;
+        unsigned long nodes = 0;
+        unsigned long backtracks = 0;
+
+        REQUIRE(getline(out, line));
+        CHECK("index,rc,clues,nodes,backtracks,max_depth,prune_sweeps,ns" == line);
+        while (getline(out, line))
+        {
+            if ('#' == line[0])
+            {
+                n_histograms++;
+                continue;
+            }
+
+            unsigned long index, clues, n, b, depth, sweeps, ns;
+            int rc;
+            char c;
+            istringstream fields(line);
+            fields >> index >> c >> rc >> c >> clues >> c >> n >> c >> b >> c >> depth >> c >> sweeps >> c >> ns;
+            CHECK(n_records == index);
+            CHECK(SUDOKU_RC_SUCCESS == rc);
+            CHECK(17 <= clues);
+            CHECK(0 < n);
+            CHECK(depth < n);
+            CHECK(n <= sweeps);
+            nodes += n;
+            backtracks += b;
+            n_records++;
+        }
+        CHECK(count == n_records);
+        CHECK(SudokuTelemetry::NUM_FIELDS == n_histograms);
+        CHECK(text_solve_calls == nodes);
+        CHECK(text_solve_calls == GetSolveCalls());
+        CHECK(0 < backtracks);
+    }
+    SUBCASE("JSON Lines and histograms")
+    {
+        stringstream out;
+        SudokuTelemetry telemetry(out, SudokuTelemetryFormat::JSONL);
+
+        for (unsigned long i = 0; i < 10; i++)
+        {
+            SudokuPuzzle p(validTestPuzzles[3]);
+            CHECK(SUDOKU_RC_SUCCESS == telemetry.Solve(p, i));
+        }
+        CHECK(10 == telemetry.Count());
+        CHECK(10 * 27 == telemetry.Sum(SudokuTelemetry::CLUES));
+        CHECK(10 == telemetry.Bucket(SudokuTelemetry::CLUES, SudokuTelemetry::BucketOf(27)));
+        CHECK(5 == SudokuTelemetry::BucketOf(27));
+        CHECK(0 == SudokuTelemetry::BucketOf(0));
+        CHECK(1 == SudokuTelemetry::BucketOf(1));
+        CHECK(64 == SudokuTelemetry::BucketOf(UINT64_MAX));
+        telemetry.Finish();
+
+        string line;
+        unsigned long n_lines = 0;
+        while (getline(out, line))
+        {
+            CHECK('{' == line.front());
+            CHECK('}' == line.back());
+            n_lines++;
+        }
+        CHECK(10 + SudokuTelemetry::NUM_FIELDS == n_lines);
+        CHECK(string::npos != out.str().find("{\"histogram\":\"clues\",\"count\":10,\"sum\":270,\"max\":27,\"buckets\":[[0,0],[1,0],[2,0],[4,0],[8,0],[16,10]]}"));
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Puzzle View")
+{
+    for (auto x : validTestPuzzles)
+    {
+        SudokuPuzzle p(x);
+        int8_t values[NUM_ROWS * NUM_COLS];
+        uint32_t masks[NUM_ROWS * NUM_COLS];
+
+        SudokuPuzzleView view = p.View();
+        CHECK(SUDOKU_RC_SUCCESS == p.GetValues(values));
+        CHECK(SUDOKU_RC_SUCCESS == p.GetCandidateMasks(masks));
+
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                CHECK(p.GetValue(row, col) == view.GetValue(row, col));
+                CHECK(values[row * NUM_COLS + col] == view.GetValue(row, col));
+                CHECK(masks[row * NUM_COLS + col] == view.GetCandidates(row, col));
+            }
+        }
+
+        /* The view follows the puzzle without copying */
+        CHECK(SUDOKU_RC_SUCCESS == p.Solve());
+        size_t n_values = 0;
+        for (const auto &cell : view)
+        {
+            n_values += (SUDOKU_MASK_NONE != cell.value) ? 1 : 0;
+        }
+        CHECK(NUM_ROWS * NUM_COLS == n_values);
+    }
+}
+
+TEST_CASE("Value Semantics")
+{
+    static_assert(std::is_trivially_copyable<SudokuPuzzle>::value, "inline storage");
+    static_assert(std::is_nothrow_move_constructible<SudokuPuzzle>::value, "noexcept move");
+    static_assert(std::is_nothrow_copy_assignable<SudokuPuzzle>::value, "noexcept copy");
+
+    SUBCASE("Copies are independent")
+    {
+        SudokuPuzzle p(validTestPuzzles[3]);
+        SudokuPuzzle q(p);
+        std::string given = p.GetPuzzleAsString();
+
+        CHECK(SUDOKU_RC_SUCCESS == q.Solve());
+        CHECK(given == p.GetPuzzleAsString());
+        CHECK(given != q.GetPuzzleAsString());
+
+        p = std::move(q);
+        CHECK(SUDOKU_RC_SUCCESS == p.Check());
+        CHECK(p.GetPuzzleAsString() == q.GetPuzzleAsString());
+    }
+    SUBCASE("Contiguous containers")
+    {
+        std::vector<SudokuPuzzle> puzzles;
+        std::ifstream file(testFileNames[3]);
+        std::string line;
+
+        while (std::getline(file, line))
+        {
+            if (NUM_ROWS * NUM_COLS == line.length())
+            {
+                puzzles.emplace_back(line);
+            }
+        }
+
+        REQUIRE(!puzzles.empty());
+        CHECK(sizeof(SudokuPuzzle) * (puzzles.size() - 1) ==
+              (size_t)((const char *)&puzzles.back() - (const char *)&puzzles.front()));
+
+        for (auto &p : puzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == p.Solve());
+        }
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Arena")
+{
+    SUBCASE("Alignment and chunk reuse")
+    {
+        SudokuArena arena(4096);
+        CHECK(0 == arena.UpstreamAllocations());
+
+        char *a = static_cast<char *>(arena.Allocate(10, 1));
+        void *b = arena.Allocate(sizeof(uint64_t), 64);
+        CHECK(0 == (reinterpret_cast<uintptr_t>(b) % 64));
+        CHECK(1 == arena.UpstreamAllocations());
+
+        /* Larger than a chunk: a chunk of its own */
+        (void)arena.Allocate(10000);
+        CHECK(2 == arena.UpstreamAllocations());
+        CHECK(3 == arena.Allocations());
+        CHECK(10000 <= arena.BytesInUse());
+
+        arena.Reset();
+        CHECK(0 == arena.BytesInUse());
+        CHECK(a == arena.Allocate(10, 1));
+        (void)arena.Allocate(sizeof(uint64_t), 64);
+        (void)arena.Allocate(10000);
+        CHECK(2 == arena.UpstreamAllocations());
+        CHECK(1 == arena.Resets());
+    }
+    SUBCASE("Batches without upstream allocations")
+    {
+        SudokuArena arena(64 * 1024);
+        std::ifstream file(testFileNames[3]);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        size_t warm_upstream = 0;
+
+        for (int batch = 0; batch < 3; batch++)
+        {
+            arena.Reset();
+
+            /* Parse scratch, puzzles and results in the arena */
+            char *scratch = arena.NewArray<char>(text.size());
+            (void)memcpy(scratch, text.data(), text.size());
+
+            SudokuArenaVector<SudokuPuzzle> puzzles{SudokuArenaAllocator<SudokuPuzzle>(arena)};
+
+            for (size_t begin = 0; begin + NUM_ROWS * NUM_COLS <= text.size();)
+            {
+                const char *end = static_cast<const char *>(memchr(scratch + begin, '\n', text.size() - begin));
+                size_t length = (nullptr != end) ? (size_t)(end - scratch) - begin : text.size() - begin;
+
+                if (NUM_ROWS * NUM_COLS == length)
+                {
+                    puzzles.emplace_back();
+                    CHECK(SUDOKU_RC_SUCCESS == puzzles.back().InitializePuzzle(scratch + begin));
+                }
+                begin += length + 1;
+            }
+
+            int8_t(*solutions)[NUM_ROWS * NUM_COLS] = arena.NewArray<int8_t[NUM_ROWS * NUM_COLS]>(puzzles.size());
+            for (size_t i = 0; i < puzzles.size(); i++)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == puzzles[i].Solve());
+                CHECK(SUDOKU_RC_SUCCESS == puzzles[i].GetValues(solutions[i]));
+                CHECK(0 < solutions[i][0]);
+            }
+            CHECK(0 < puzzles.size());
+
+            if (0 == batch)
+            {
+                warm_upstream = arena.UpstreamAllocations();
+            }
+            CHECK(warm_upstream == arena.UpstreamAllocations());
+        }
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Interleaved Solver")
+{
+    std::vector<struct SudokuPuzzle_S> givens;
+    std::vector<std::string> lines;
+    std::ifstream file(testFileNames[3]);
+    std::string line;
+    struct SudokuPuzzle_S p;
+
+    while (std::getline(file, line))
+    {
+        if ((NUM_ROWS * NUM_COLS == line.length()) && (SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, line.c_str())))
+        {
+            givens.push_back(p);
+            lines.push_back(line);
+        }
+    }
+    for (auto x : invalidTestPuzzles)
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+        givens.push_back(p);
+    }
+
+    /* Reference: the puzzles one after the other */
+    std::vector<struct SudokuPuzzle_S> reference(givens);
+    Sudoku_Stats_T sequential;
+    size_t n_solved = Solve_Interleaved(reference, 1, sequential);
+    CHECK(givens.size() - invalidTestPuzzles.size() == n_solved);
+    CHECK(0 < sequential.solve_calls);
+
+    for (unsigned int width : {2u, 3u, 8u})
+    {
+        std::vector<struct SudokuPuzzle_S> puzzles(givens);
+        std::vector<Sudoku_RC_T> rcs(puzzles.size(), SUDOKU_RC_PRUNE);
+        Sudoku_Stats_T stats;
+
+        CHECK(n_solved == Solve_Interleaved(puzzles, width, stats, rcs.data()));
+        CHECK(sequential.solve_calls == stats.solve_calls);
+        CHECK(sequential.backtracks == stats.backtracks);
+        CHECK(sequential.max_level == stats.max_level);
+
+        for (size_t i = 0; i < puzzles.size(); i++)
+        {
+            CHECK(Sudoku_GetHash(&reference[i]) == Sudoku_GetHash(&puzzles[i]));
+            CHECK(((i < n_solved) ? SUDOKU_RC_SUCCESS : SUDOKU_RC_ERROR) == rcs[i]);
+        }
+    }
+
+    /* Same solutions as the recursive solver */
+    for (size_t i = 0; i < n_solved; i += 17)
+    {
+        SudokuPuzzle q(lines[i]);
+        int8_t values[NUM_ROWS * NUM_COLS];
+        int8_t reference_values[NUM_ROWS * NUM_COLS];
+
+        CHECK(SUDOKU_RC_SUCCESS == q.Solve());
+        CHECK(SUDOKU_RC_SUCCESS == q.GetValues(values));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_GetValues(&reference[i], reference_values));
+        CHECK(0 == memcmp(values, reference_values, sizeof(values)));
+    }
+
+    /* Empty batch */
+    std::vector<struct SudokuPuzzle_S> empty;
+    Sudoku_Stats_T stats;
+    CHECK(0 == Solve_Interleaved(empty, 0, stats));
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Propagation Levels")
+{
+    std::vector<std::string> givens;
+    std::ifstream file(testFileNames[3]);
+    std::string line;
+    unsigned int singles_calls = 0;
+
+    while (std::getline(file, line))
+    {
+        if (NUM_ROWS * NUM_COLS == line.length())
+        {
+            givens.push_back(line);
+        }
+    }
+
+    for (auto level : {SUDOKU_PROPAGATE_SINGLES, SUDOKU_PROPAGATE_HIDDEN, SUDOKU_PROPAGATE_LOCKED, SUDOKU_PROPAGATE_SUBSETS, SUDOKU_PROPAGATE_FISH})
+    {
+        SudokuSolveOptions options;
+        Sudoku_SolveOptions_T c_options = {options.config, 0, nullptr, nullptr, level, 0};
+        unsigned int solve_calls = 0;
+        Sudoku_PropagationStats_T deductions = {};
+
+        options.propagation = level;
+        for (size_t i = 0; i < givens.size(); i++)
+        {
+            SudokuPuzzle p(givens[i]);
+            SudokuSolveStats stats = {};
+
+            CHECK(SUDOKU_RC_SUCCESS == p.Solve(options, &stats));
+            CHECK(SUDOKU_RC_SUCCESS == p.Check());
+            solve_calls += stats.solve_calls;
+            Sudoku_AccumulatePropagationStats(&deductions, &stats.propagation);
+
+            /* The solution keeps the givens */
+            std::string solution = p.GetPuzzleAsString();
+            for (size_t k = 0; k < givens[i].length(); k++)
+            {
+                if (('1' <= givens[i][k]) && (givens[i][k] <= '9'))
+                {
+                    CHECK(givens[i][k] == solution[k]);
+                }
+            }
+
+            /* Same search as the reentrant C solver */
+            if (0 == (i % 17))
+            {
+                static Sudoku_Workspace_T ws;
+                struct SudokuPuzzle_S q;
+                Sudoku_Stats_T c_stats;
+                int8_t values[NUM_ROWS * NUM_COLS];
+                int8_t c_values[NUM_ROWS * NUM_COLS];
+
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, givens[i].c_str()));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&q, &ws, &c_options, &c_stats));
+                CHECK(SUDOKU_RC_SUCCESS == p.GetValues(values));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_GetValues(&q, c_values));
+                CHECK(0 == memcmp(values, c_values, sizeof(values)));
+                CHECK(stats.solve_calls == c_stats.solve_calls);
+            }
+        }
+
+        for (auto x : invalidTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_ERROR == p.Solve(options));
+        }
+
+        /* Stronger propagation searches fewer nodes */
+        if (SUDOKU_PROPAGATE_SINGLES == level)
+        {
+            singles_calls = solve_calls;
+            CHECK(0 == deductions.hidden_singles);
+        }
+        else
+        {
+            CHECK(solve_calls < singles_calls);
+            CHECK(0 < deductions.hidden_singles);
+        }
+        CHECK((SUDOKU_PROPAGATE_FISH == level) == (0 < deductions.fish_eliminations));
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Failed-Candidate Probing")
+{
+    std::vector<std::string> givens;
+    std::ifstream file(testFileNames[3]);
+    std::string line;
+    unsigned int unprobed_calls = 0;
+
+    while (std::getline(file, line))
+    {
+        if (NUM_ROWS * NUM_COLS == line.length())
+        {
+            givens.push_back(line);
+        }
+    }
+
+    for (unsigned int budget : {0u, 1u, 16u})
+    {
+        SudokuSolveOptions options;
+        Sudoku_SolveOptions_T c_options = {options.config, 0, nullptr, nullptr, SUDOKU_PROPAGATE_SINGLES, budget};
+        unsigned int solve_calls = 0;
+        unsigned int probes = 0;
+
+        options.probe_budget = budget;
+        for (size_t i = 0; i < givens.size(); i++)
+        {
+            SudokuPuzzle p(givens[i]);
+            SudokuSolveStats stats = {};
+
+            CHECK(SUDOKU_RC_SUCCESS == p.Solve(options, &stats));
+            CHECK(SUDOKU_RC_SUCCESS == p.Check());
+            solve_calls += stats.solve_calls;
+            probes += stats.propagation.probes;
+
+            /* The solution keeps the givens */
+            std::string solution = p.GetPuzzleAsString();
+            for (size_t k = 0; k < givens[i].length(); k++)
+            {
+                if (('1' <= givens[i][k]) && (givens[i][k] <= '9'))
+                {
+                    CHECK(givens[i][k] == solution[k]);
+                }
+            }
+
+            /* Same search as the reentrant C solver */
+            if (0 == (i % 17))
+            {
+                static Sudoku_Workspace_T ws;
+                struct SudokuPuzzle_S q;
+                Sudoku_Stats_T c_stats;
+                int8_t values[NUM_ROWS * NUM_COLS];
+                int8_t c_values[NUM_ROWS * NUM_COLS];
+
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, givens[i].c_str()));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&q, &ws, &c_options, &c_stats));
+                CHECK(SUDOKU_RC_SUCCESS == p.GetValues(values));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_GetValues(&q, c_values));
+                CHECK(0 == memcmp(values, c_values, sizeof(values)));
+                CHECK(stats.solve_calls == c_stats.solve_calls);
+            }
+        }
+
+        for (auto x : invalidTestPuzzles)
+        {
+            SudokuPuzzle p(x);
+            CHECK(SUDOKU_RC_ERROR == p.Solve(options));
+        }
+
+        /* Probing refutes candidates without branching on them */
+        if (0 == budget)
+        {
+            unprobed_calls = solve_calls;
+            CHECK(0 == probes);
+        }
+        else
+        {
+            CHECK(solve_calls < unprobed_calls);
+            CHECK(0 < probes);
+        }
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+TEST_CASE("Hints")
+{
+    unsigned long techniques[SUDOKU_HINT_CONTRADICTION + 1] = {0};
+    unsigned long unsound = 0;
+
+    auto result = Process_File(testFileNames[3], [&](SudokuPuzzle &p)
+                               {
+        SudokuPuzzle solution(p);
+        Sudoku_Hint_T hint;
+        Sudoku_RC_T rc;
+
+        if (SUDOKU_RC_SUCCESS != solution.Solve(SUDOKU_ENGINE_DLX))
+        {
+            return SUDOKU_RC_ERROR;
+        }
+
+        while ((SUDOKU_RC_SUCCESS == (rc = p.NextHint(hint))) && (SUDOKU_HINT_NONE != hint.technique))
+        {
+            techniques[hint.technique]++;
+
+            for (unsigned int i = 0; i < hint.n_eliminations; i++)
+            {
+                unsigned int value = (unsigned int)solution.GetValue(hint.elim_cells[i] / 9, hint.elim_cells[i] % 9);
+                unsound += (hint.elim_candidates[i] & (1u << (value - 1))) ? 1 : 0;
+            }
+            if (0 == hint.n_eliminations)
+            {
+                unsigned int value = (unsigned int)solution.GetValue(hint.cells[0] / 9, hint.cells[0] % 9);
+                unsound += (hint.values != (1u << (value - 1))) ? 1 : 0;
+            }
+
+            (void)p.ApplyHint(hint);
+        }
+
+        return rc; });
+
+    CHECK(0 == unsound);
+    CHECK(0 == get<2>(result));
+    CHECK(0 == techniques[SUDOKU_HINT_CONTRADICTION]);
+    for (int t = SUDOKU_HINT_FULL_HOUSE; t < SUDOKU_HINT_CONTRADICTION; t++)
+    {
+        CHECK(0 < techniques[t]);
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
+/**
+ * @brief Candidate mask of a cell, recomputed from the values of its units.
+ */
+static uint32_t Sudoku_Unit_Candidates(const string &p, unsigned int row, unsigned int col)
+{
+    uint32_t mask = SUDOKU_MASK_ALL;
+
+    if ('0' != p[row * 9 + col])
+    {
+        return SUDOKU_MASK_NONE;
+    }
+
+    for (unsigned int k = 0; k < 9; k++)
+    {
+        for (unsigned int cell : {row * 9 + k, k * 9 + col, (3 * (row / 3) + k / 3) * 9 + 3 * (col / 3) + k % 3})
+        {
+            if ('0' != p[cell])
+            {
+                mask &= ~((uint32_t)1 << (p[cell] - '1'));
+            }
+        }
+    }
+
+    return mask;
+}
+
+TEST_CASE("Interactive Session")
+{
+    SUBCASE("Incremental candidates")
+    {
+        SudokuSession session(validTestPuzzles[3]);
+        uint32_t rng = 0x2545F491u;
+
+        for (unsigned int edit = 0; edit < 2000; edit++)
+        {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+
+            unsigned int row = rng % 9;
+            unsigned int col = (rng / 9) % 9;
+            unsigned int val = (rng / 81) % 10;
+
+            if (session.IsGiven(row, col))
+            {
+                CHECK(SUDOKU_RC_INVALID_INPUT == session.Erase(row, col));
+                continue;
+            }
+
+            CHECK(SUDOKU_RC_SUCCESS == ((0 == val) ? session.Erase(row, col) : session.Place(row, col, (Sudoku_Values_T)val)));
+
+            string p = session.GetPuzzleAsString();
+            bool dead = false;
+
+            for (unsigned int r = 0; r < 9; r++)
+            {
+                for (unsigned int c = 0; c < 9; c++)
+                {
+                    CHECK(Sudoku_Unit_Candidates(p, r, c) == session.GetCandidates(r, c));
+                    dead = dead || (('0' == p[r * 9 + c]) && (SUDOKU_MASK_NONE == session.GetCandidates(r, c)));
+                }
+            }
+
+            SudokuPuzzle p_ref(p);
+            CHECK(session.IsValid() == ((SUDOKU_RC_ERROR != p_ref.Check()) && !dead));
+        }
+    }
+    SUBCASE("Solvability and uniqueness")
+    {
+        SudokuSession session(validTestPuzzles[3]);
+        SudokuPuzzle solved(validTestPuzzles[3]);
+        CHECK(SUDOKU_RC_SUCCESS == solved.Solve());
+
+        CHECK(session.IsSolvable());
+        CHECK(session.IsUnique());
+        CHECK(1 == session.Searches());
+
+        /* Correct placements and erasures stay covered by the cached solution and uniqueness proof */
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(0, 0, solved.GetValue(0, 0)));
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(8, 8, solved.GetValue(8, 8)));
+        CHECK(session.IsSolvable());
+        CHECK(session.IsUnique());
+        CHECK(SUDOKU_RC_SUCCESS == session.Erase(8, 8));
+        CHECK(session.IsUnique());
+        CHECK(1 == session.Searches());
+
+        /* A wrong value is only detected by a search */
+        Sudoku_Values_T wrong = SUDOKU_NO_VALUE;
+        for (unsigned int v = 1; v <= 9; v++)
+        {
+            if ((session.GetCandidates(8, 8) & (1u << (v - 1))) && (v != (unsigned int)solved.GetValue(8, 8)))
+            {
+                wrong = (Sudoku_Values_T)v;
+                break;
+            }
+        }
+        REQUIRE(SUDOKU_NO_VALUE != wrong);
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(8, 8, wrong));
+        CHECK(session.IsValid());
+        CHECK(!session.IsSolvable());
+        CHECK(2 == session.Searches());
+
+        /* Further placements keep the grid unsolvable, erasing the wrong value restores the solution */
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(8, 7, solved.GetValue(8, 7)));
+        CHECK(!session.IsSolvable());
+        CHECK(SUDOKU_RC_SUCCESS == session.Erase(8, 8));
+        CHECK(session.IsSolvable());
+        CHECK(session.IsUnique());
+        CHECK(2 == session.Searches());
+
+        CHECK(SUDOKU_RC_INVALID_INPUT == session.Place(0, 2, SUDOKU_VALUE_1)); /* Given */
+        CHECK(SUDOKU_RC_INVALID_VALUE == session.Place(0, 0, SUDOKU_INVALID_VALUE_10));
+    }
+    SUBCASE("Multiple solutions")
+    {
+        /* Solved grid with an unavoidable rectangle (rows 1 and 3, columns 1 and 7) left open */
+        SudokuSession session(".74236.58638591742.25487.36316754289742918563589362417867125394253649871491873625");
+
+        CHECK(session.IsSolvable());
+        CHECK(!session.IsUnique());
+        CHECK(1 == session.Searches());
+
+        /* One of the two cached solutions still covers the grid, but uniqueness needs a search */
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(0, 0, SUDOKU_VALUE_1));
+        CHECK(session.IsSolvable());
+        CHECK(1 == session.Searches());
+        CHECK(session.IsUnique());
+        CHECK(2 == session.Searches());
+
+        /* Erasing it brings back both cached solutions */
+        CHECK(SUDOKU_RC_SUCCESS == session.Erase(0, 0));
+        CHECK(!session.IsUnique());
+        CHECK(2 == session.Searches());
+    }
+    SUBCASE("Conflicts")
+    {
+        SudokuSession session;
+
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(0, 0, SUDOKU_VALUE_5));
+        CHECK(SUDOKU_RC_SUCCESS == session.Place(1, 1, SUDOKU_VALUE_5));
+        CHECK(session.IsConflicting(0, 0));
+        CHECK(session.IsConflicting(1, 1));
+        CHECK(!session.IsValid());
+        CHECK(!session.IsSolvable());
+        CHECK(SUDOKU_RC_SUCCESS == session.Erase(1, 1));
+        CHECK(!session.IsConflicting(0, 0));
+        CHECK(session.IsSolvable());
+        CHECK(!session.IsUnique());
+        CHECK(!session.IsComplete());
+    }
+
+    /* Reset max_level and solve calls */
+    ResetMaxLevel();
+    ResetSolveCalls();
+}
+
 /**
  * @brief This Dataset tests (mostly) the pruning algorithm
  *
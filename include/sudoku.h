@@ -94,8 +94,125 @@ extern "C"
         SUDOKU_RC_NOT_SOLVABLE = -1, /**< Sudoku puzzle is not solvable */
         SUDOKU_RC_SUCCESS = 0,       /**< Operation was successful */
         SUDOKU_RC_PRUNE = 1,         /**< Operation was successful, but the puzzle is not completely solved yet */
+        SUDOKU_RC_CANCELLED = 2,     /**< Operation was cancelled before completion */
+        SUDOKU_RC_BUDGET_EXHAUSTED = 3, /**< Node or time budget ran out before completion */
     } Sudoku_RC_T;
 
+    /**
+     * @brief Sudoku solver engine selection.
+     *
+     * Selects the search algorithm used to solve or count the solutions of a puzzle.
+     */
+    typedef enum Sudoku_Engine_E
+    {
+        SUDOKU_ENGINE_PRUNE = 0, /**< Candidate mask pruning and backtracking (default) */
+        SUDOKU_ENGINE_DLX,       /**< Exact cover search using Algorithm X with Dancing Links */
+        SUDOKU_ENGINE_BACKJUMP,  /**< Pruning with conflict-directed backjumping (solving only, counts use SUDOKU_ENGINE_PRUNE) */
+    } Sudoku_Engine_T;
+
+    /**
+     * @brief Cell scoring used to select the branching cell.
+     *
+     * The cell with the lowest score is branched on.
+     */
+    typedef enum Sudoku_BranchScore_E
+    {
+        SUDOKU_SCORE_WEIGHTED = 0, /**< 3 * cell candidates + row, column and subgrid candidates, Sudoku_ScoreWeighted() (default) */
+        SUDOKU_SCORE_MRV,          /**< Cell candidates only (minimum remaining values), Sudoku_ScoreMRV() */
+        SUDOKU_SCORE_UNITS,        /**< Cell, row, column and subgrid candidates with equal weight, Sudoku_ScoreEqualWeights() */
+    } Sudoku_BranchScore_T;
+
+    /**
+     * @brief Ordering of the candidate values of equally scored cells.
+     */
+    typedef enum Sudoku_ValueOrder_E
+    {
+        SUDOKU_ORDER_LEAST_FREQUENT = 0, /**< Value with the fewest candidates in the puzzle first, Sudoku_OrderLeastFrequent() (default) */
+        SUDOKU_ORDER_MOST_FREQUENT,      /**< Value with the most candidates in the puzzle first, Sudoku_OrderMostFrequent() */
+        SUDOKU_ORDER_ASCENDING,          /**< Lowest value first, Sudoku_OrderAscending() */
+    } Sudoku_ValueOrder_T;
+
+    /**
+     * @brief Propagation strength, applied at every search node.
+     *
+     * Each level adds its techniques to those of the levels before it. Stronger levels spend more
+     * time per node to search fewer nodes.
+     */
+    typedef enum Sudoku_Propagation_E
+    {
+        SUDOKU_PROPAGATE_SINGLES = 0, /**< Peer elimination and naked singles, as Sudoku_PrunePuzzle() (default) */
+        SUDOKU_PROPAGATE_HIDDEN,      /**< Hidden singles, and values without a place as contradictions */
+        SUDOKU_PROPAGATE_LOCKED,      /**< Locked candidates (pointing and claiming) */
+        SUDOKU_PROPAGATE_SUBSETS,     /**< Naked and hidden pairs and triples */
+        SUDOKU_PROPAGATE_FISH,        /**< X-Wing and Swordfish */
+    } Sudoku_Propagation_T;
+
+    /**
+     * @brief Deductions made by the propagation techniques beyond naked singles.
+     */
+    typedef struct Sudoku_PropagationStats_S
+    {
+        unsigned int hidden_singles;      /**< Values placed as hidden singles */
+        unsigned int locked_eliminations; /**< Candidates removed by pointing and claiming */
+        unsigned int subset_eliminations; /**< Candidates removed by naked and hidden pairs and triples */
+        unsigned int fish_eliminations;   /**< Candidates removed by X-Wings and Swordfish */
+        unsigned int probes;              /**< Candidates of bivalue cells tried by probing */
+        unsigned int probe_eliminations;  /**< Candidates removed by probing */
+    } Sudoku_PropagationStats_T;
+
+    /* Branching heuristic table, see sudoku_heuristic.h */
+    struct Sudoku_Heuristic_S;
+
+    /**
+     * @brief Search configuration used to select branching candidates.
+     */
+    typedef struct Sudoku_SearchConfig_S
+    {
+        Sudoku_BranchScore_T score; /**< Cell scoring */
+        Sudoku_ValueOrder_T order;  /**< Value ordering */
+        uint32_t seed;              /**< Seed for random tie-breaking. 0 keeps the first candidate found */
+        /** Heuristic table replacing score and order (see sudoku_heuristic.h). NULL uses score and order */
+        const struct Sudoku_Heuristic_S *heuristic;
+    } Sudoku_SearchConfig_T;
+
+    /**
+     * @brief Logical solving techniques reported by hints, in order of increasing cost.
+     */
+    typedef enum Sudoku_HintTechnique_E
+    {
+        SUDOKU_HINT_NONE = 0,      /**< No deduction (solved puzzle, or search needed) */
+        SUDOKU_HINT_FULL_HOUSE,    /**< Last empty cell of a unit */
+        SUDOKU_HINT_NAKED_SINGLE,  /**< Cell with a single candidate */
+        SUDOKU_HINT_HIDDEN_SINGLE, /**< Value with a single place in a unit */
+        SUDOKU_HINT_POINTING,      /**< Value of a subgrid confined to one row or column */
+        SUDOKU_HINT_CLAIMING,      /**< Value of a row or column confined to one subgrid */
+        SUDOKU_HINT_NAKED_PAIR,    /**< Two cells of a unit with the same two candidates */
+        SUDOKU_HINT_HIDDEN_PAIR,   /**< Two values of a unit confined to the same two cells */
+        SUDOKU_HINT_CONTRADICTION, /**< Repeated value, cell without candidates or value without a place */
+    } Sudoku_HintTechnique_T;
+
+    /**
+     * @brief A single logical deduction.
+     *
+     * Cells are numbered row * 9 + column. Units are numbered 0-8 for rows, 9-17 for columns
+     * and 18-26 for subgrids (row-major).
+     *
+     * Singles place @ref values in cells[0]. The other techniques remove candidates: the deduction
+     * is based on the values @ref values in the cells @ref cells, and removes elim_candidates[i]
+     * from elim_cells[i].
+     */
+    typedef struct Sudoku_Hint_S
+    {
+        Sudoku_HintTechnique_T technique;                  /**< Technique of the deduction */
+        uint8_t unit;                                      /**< Unit the deduction was found in */
+        uint8_t n_cells;                                   /**< Number of cells the deduction is based on */
+        uint8_t cells[NUM_SUBGRID_ELEMENTS];               /**< Cells the deduction is based on */
+        uint32_t values;                                   /**< Value mask of the deduction */
+        uint8_t n_eliminations;                            /**< Number of cells losing candidates */
+        uint8_t elim_cells[NUM_SUBGRID_ELEMENTS];          /**< Cells losing candidates */
+        uint32_t elim_candidates[NUM_SUBGRID_ELEMENTS];    /**< Candidates removed from each cell */
+    } Sudoku_Hint_T;
+
     /// @brief Type used for Sudoku Row Index.
     typedef size_t Sudoku_Row_Index_T;
 
@@ -103,19 +220,114 @@ extern "C"
     typedef size_t Sudoku_Column_Index_T;
 
     /**
-     * @brief Sudoku Cell Object Reference
+     * @brief Represents a single cell in the Sudoku grid.
      *
-     * Forward declaration of the Sudoku Cell Object as C-Style opaque type
+     * The layout is public so that the grid can be read in place through Sudoku_GetGrid().
+     */
+    struct SudokuCell_S
+    {
+        uint32_t value;      /**< Value mask. */
+        uint32_t candidates; /**< Candidate mask. */
+    };
+
+    /**
+     * @brief Sudoku Cell Object Reference
      */
     typedef struct SudokuCell_S *SudokuCell_P;
 
     /**
-     * @brief Sudoku Puzzle Object Reference.
+     * @brief Represents the Sudoku grid and its metadata.
      *
-     * Forward declaration of the Sudoku Puzzle Object as C-Style opaque type
+     * The layout is public so that puzzles can be held by value, e.g. on the stack or inline in
+     * SudokuPuzzle. The fields are maintained by the library functions and should not be written directly.
+     */
+    struct SudokuPuzzle_S
+    {
+        struct SudokuCell_S grid[NUM_ROWS][NUM_COLS];                /**< A 9x9 grid of Sudoku cells. */
+        uint32_t row_candidates[NUM_ROWS];                           /**< Candidates for each row. */
+        uint32_t col_candidates[NUM_COLS];                           /**< Candidates for each column. */
+        uint32_t sub_candidates[NUM_SUBGRID_ROWS][NUM_SUBGRID_COLS]; /**< Candidates for each subgrid. */
+
+        unsigned int n_candidates[NUM_ROWS][NUM_COLS]; /**< Number of candidates for each cell in the grid. */
+        unsigned int val_n_candidates[NUM_CANDIDATES]; /**< Number of candidates for each possible value (1 to 9) in the puzzle. */
+        uint32_t n_row_candidates[NUM_ROWS];
+        uint32_t n_col_candidates[NUM_ROWS];
+        uint32_t n_sub_candidates[NUM_SUBGRID_ROWS][NUM_SUBGRID_COLS];
+
+        unsigned int n_filled;    /**< Number of cells with a value, counted by the last pruning pass. */
+        unsigned int n_conflicts; /**< Repeated or invalid values found by the last pruning pass. */
+        unsigned int n_sweeps;    /**< Number of passes over the grid made by the last pruning. */
+
+        uint64_t hash; /**< Zobrist hash of the cell values, updated with every value change. */
+    };
+
+    /**
+     * @brief Sudoku Puzzle Object Reference.
      */
     typedef struct SudokuPuzzle_S *SudokuPuzzle_P;
 
+    /**
+     * @brief Options of Sudoku_Solve().
+     */
+    typedef struct Sudoku_SolveOptions_S
+    {
+        Sudoku_SearchConfig_T config;     /**< Branching score, value ordering and random seed */
+        unsigned long max_nodes;          /**< Maximum number of search nodes. 0 means unlimited */
+        int (*cancel)(void *user);        /**< Polled once per node, non-zero cancels the solve. May be NULL */
+        void *user;                       /**< Passed to cancel */
+        Sudoku_Propagation_T propagation; /**< Propagation strength at every node */
+        unsigned int probe_budget;        /**< Candidates of bivalue cells probed per node. 0 disables probing */
+    } Sudoku_SolveOptions_T;
+
+    /**
+     * @brief Statistics of a single call to Sudoku_Solve().
+     */
+    typedef struct Sudoku_Stats_S
+    {
+        unsigned int max_level;                /**< Maximum search depth reached */
+        unsigned int solve_calls;              /**< Number of search nodes */
+        unsigned int backtracks;               /**< Number of branches that failed and were undone */
+        unsigned int prune_sweeps;             /**< Number of propagation passes over the grid */
+        Sudoku_PropagationStats_T propagation; /**< Deductions of the techniques beyond naked singles */
+    } Sudoku_Stats_T;
+
+    /**
+     * @brief Search state saved before branching on one level. Private to Sudoku_Solve().
+     */
+    typedef struct Sudoku_SolveFrame_S
+    {
+        struct SudokuCell_S grid[NUM_ROWS][NUM_COLS]; /**< Values and candidates before the branch */
+        uint64_t hash;                                /**< Hash of the values before the branch */
+        uint8_t row;                                  /**< Row of the branching cell */
+        uint8_t col;                                  /**< Column of the branching cell */
+        uint32_t candidate;                           /**< Value tried on the branching cell */
+    } Sudoku_SolveFrame_T;
+
+    /**
+     * @brief Fixed-size workspace of Sudoku_Solve(), about 54 kB.
+     *
+     * One frame per search level, since every level places at least one value. May be allocated
+     * on the stack or in a pool, and reused by later solves. Contents need no initialization.
+     */
+    typedef struct Sudoku_Workspace_S
+    {
+        Sudoku_SolveFrame_T frames[NUM_ROWS * NUM_COLS];
+    } Sudoku_Workspace_T;
+
+    /**
+     * @brief Resumable solve, advanced one search node at a time by Sudoku_SolveStep().
+     */
+    typedef struct Sudoku_SolveTask_S
+    {
+        struct SudokuPuzzle_S *puzzle; /**< Puzzle being solved */
+        Sudoku_Workspace_T *ws;        /**< Workspace of the solve */
+        Sudoku_SolveOptions_T options; /**< Options of the solve */
+        Sudoku_Stats_T stats;          /**< Statistics so far */
+        uint32_t rng_state;            /**< Random tie-breaking state */
+        unsigned int level;            /**< Current search depth */
+        Sudoku_RC_T rc;                /**< Status of the current node */
+    } Sudoku_SolveTask_T;
+
     /* ********************************************************************** */
     /* ********************************************************************** */
     /* ********************************************************************** */
@@ -199,13 +411,49 @@ extern "C"
      */
     int Sudoku_GetValue(SudokuPuzzle_P p, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col);
 
+    /**
+     * @brief Converts a value or candidate mask of a cell into a numeric value.
+     *
+     * @param mask Value or candidate mask.
+     * @return SUDOKU_NO_VALUE for an empty mask, the value (1-9) for a single bit and
+     *         SUDOKU_NOT_EXCLUSIVE_VALUE if more than one bit is set.
+     */
+    Sudoku_Values_T Sudoku_MaskToValue(uint32_t mask);
+
+    /**
+     * @brief Gets the values of all cells in one call.
+     *
+     * @param p Valid reference to a Sudoku Puzzle.
+     * @param values Receives the 81 values in row-major order, with the same numbering as Sudoku_GetValue().
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, or SUDOKU_RC_NULL_POINTER.
+     */
+    Sudoku_RC_T Sudoku_GetValues(const struct SudokuPuzzle_S *p, int8_t values[NUM_ROWS * NUM_COLS]);
+
+    /**
+     * @brief Gets the raw candidate masks of all cells in one call.
+     *
+     * @param p Valid reference to a Sudoku Puzzle.
+     * @param masks Receives the 81 candidate masks in row-major order (bit n for value n + 1).
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, or SUDOKU_RC_NULL_POINTER.
+     */
+    Sudoku_RC_T Sudoku_GetCandidateMasks(const struct SudokuPuzzle_S *p, uint32_t masks[NUM_ROWS * NUM_COLS]);
+
+    /**
+     * @brief Gets the cells of a puzzle for reading in place.
+     *
+     * @param p Valid reference to a Sudoku Puzzle.
+     * @return The 81 cells in row-major order, or NULL. Valid as long as the puzzle is.
+     */
+    const struct SudokuCell_S *Sudoku_GetGrid(const struct SudokuPuzzle_S *p);
+
     /**
      * @brief Checks if the given Sudoku puzzle is valid or not.
      *
      * This function takes a pointer to a SudokuPuzzle and checks if it's valid or not.
      * It calls four other static functions to perform the checks, namely checkRows,
      * checkCols, checkSubgrid, and checkEmptyVals. If the puzzle is invalid, this function
-     * returns an appropriate error code.
+     * returns an appropriate error code. Unlike Sudoku_GetStatus(), it does not rely on a previous
+     * pruning and is meant for validating untrusted input.
      *
      * @param p Pointer to the SudokuPuzzle to be checked.
      * @return Sudoku_RC_T The result of the Sudoku check operation.
@@ -245,18 +493,179 @@ extern "C"
      */
     Sudoku_BitValues_T Sudoku_SelectCandidate(SudokuPuzzle_P p, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col);
 
+    /**
+     * @brief Selects a candidate value for a cell using a search configuration.
+     *
+     * Same selection as Sudoku_SelectCandidate(), with configurable cell scoring and value ordering:
+     * the functions of sudoku_heuristic.h selected by score and order, or those of the heuristic table.
+     * Candidates that tie on both are either resolved in favour of the first one found or, if the
+     * configuration has a seed, picked uniformly at random using the caller-owned generator state.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @param[in] config Search configuration. NULL selects the default configuration.
+     * @param[in,out] rng_state Random generator state, initialized with the configuration seed. May be NULL if the seed is 0.
+     * @param[out] row Pointer to a variable where the row index of the selected cell will be stored
+     * @param[out] col Pointer to a variable where the column index of the selected cell will be stored
+     * @return A selected candidate value if a suitable cell is found, otherwise SUDOKU_BIT_INVALID_VALUE
+     */
+    Sudoku_BitValues_T Sudoku_SelectCandidateUsingConfig(SudokuPuzzle_P p, const Sudoku_SearchConfig_T *config, uint32_t *rng_state, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col);
+
     /**
      * @brief Prunes the Sudoku puzzle by iteratively generating candidate masks and updating cell candidates.
      *
      * This function repeatedly calls the functions to generate column masks, row masks, subgrid masks, and
      * puzzle cell masks, and updates the puzzle's candidates until no more changes are detected.
-     * After pruning, the function checks if the Sudoku puzzle is solved or if an error has occurred.
+     * Filled cells and repeated values are counted during the last pass, so the status is known
+     * without rescanning the grid with Sudoku_Check().
      *
      * @param[in] p Pointer to a Sudoku puzzle structure
-     * @return A Sudoku return code indicating the status of the puzzle after pruning (SUDOKU_RC_SUCCESS, SUDOKU_RC_SOLVED, or SUDOKU_RC_ERROR)
+     * @return A Sudoku return code indicating the status of the puzzle after pruning (SUDOKU_RC_SUCCESS, SUDOKU_RC_PRUNE, or SUDOKU_RC_ERROR)
      */
     Sudoku_RC_T Sudoku_PrunePuzzle(SudokuPuzzle_P p);
 
+    /**
+     * @brief Prunes the puzzle like Sudoku_PrunePuzzle(), then applies the techniques of a propagation level.
+     *
+     * The techniques run on bitmask planes holding, for every value and unit, the positions the value
+     * can take in the unit. They are tried from the cheapest on, and pruning resumes after every
+     * technique that removed candidates, until none applies. n_sweeps counts the passes of all prunings.
+     * Sudoku_ProbePuzzle() adds failed-candidate probing on top.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @param[in] level Propagation strength
+     * @param[in,out] stats Deduction counters, incremented. May be NULL
+     * @return The status of the puzzle as returned by Sudoku_PrunePuzzle()
+     */
+    Sudoku_RC_T Sudoku_PropagatePuzzle(SudokuPuzzle_P p, Sudoku_Propagation_T level, Sudoku_PropagationStats_T *stats);
+
+    /**
+     * @brief Propagates like Sudoku_PropagatePuzzle(), then probes the candidates of bivalue cells.
+     *
+     * Each of the two candidates of a bivalue cell is placed on a scratch copy of the puzzle and
+     * propagated at the same level. A candidate whose copy runs into a contradiction is removed, and
+     * if both copies hold, the candidates ruled out in both are removed from every cell. Propagation
+     * resumes after every probe that removed candidates.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @param[in] level Propagation strength, of the puzzle and of the probes
+     * @param[in] budget Maximum number of candidates probed. 0 only propagates
+     * @param[in,out] stats Deduction counters, incremented. Deductions inside probes are not counted. May be NULL
+     * @return The status of the puzzle as returned by Sudoku_PrunePuzzle()
+     */
+    Sudoku_RC_T Sudoku_ProbePuzzle(SudokuPuzzle_P p, Sudoku_Propagation_T level, unsigned int budget, Sudoku_PropagationStats_T *stats);
+
+    /**
+     * @brief Adds deduction counters to a total.
+     *
+     * @param[in,out] total Counters to add to
+     * @param[in] stats Counters to add
+     */
+    void Sudoku_AccumulatePropagationStats(Sudoku_PropagationStats_T *total, const Sudoku_PropagationStats_T *stats);
+
+    /**
+     * @brief Gets the status of the puzzle counted by the last call to Sudoku_PrunePuzzle().
+     *
+     * Constant time. Values set after the last pruning are not taken into account; use
+     * Sudoku_Check() to validate a puzzle from untrusted input.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @return SUDOKU_RC_SUCCESS if solved, SUDOKU_RC_PRUNE if cells are left to branch on,
+     *         SUDOKU_RC_ERROR on a contradiction, or SUDOKU_RC_NULL_POINTER.
+     */
+    Sudoku_RC_T Sudoku_GetStatus(const struct SudokuPuzzle_S *p);
+
+    /**
+     * @brief Gets the Zobrist hash of the cell values of a puzzle.
+     *
+     * The hash is the exclusive or of a fixed 64-bit key per cell and value, kept up to date by every
+     * value change. Puzzles with the same values have the same hash, whatever the order in which
+     * the values were placed. Empty cells and invalid values do not contribute.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @return The hash, 0 for an empty grid or a NULL pointer.
+     */
+    uint64_t Sudoku_GetHash(const struct SudokuPuzzle_S *p);
+
+    /**
+     * @brief Solves a puzzle with pruning and backtracking.
+     *
+     * Same search as SudokuPuzzle::Solve() with the pruning engine, without recursion: the state of
+     * every level is saved in the workspace before branching and restored when the branch fails.
+     * Reentrant: no memory is allocated and no global state is used, so concurrent solves only need
+     * their own puzzle and workspace.
+     *
+     * @param[in,out] p Pointer to a Sudoku puzzle structure. Holds the solution on success. Otherwise
+     *                  the root state is left pruned, with the values refuted at the root removed.
+     * @param[in] ws Workspace
+     * @param[in] options Options, NULL for the default branching without limits
+     * @param[out] stats Statistics of the search. May be NULL
+     * @return SUDOKU_RC_SUCCESS if solved, SUDOKU_RC_ERROR if the puzzle has no solution,
+     *         SUDOKU_RC_BUDGET_EXHAUSTED if max_nodes were searched, SUDOKU_RC_CANCELLED if cancelled,
+     *         SUDOKU_RC_NULL_POINTER if a reference is NULL.
+     */
+    Sudoku_RC_T Sudoku_Solve(SudokuPuzzle_P p, Sudoku_Workspace_T *ws, const Sudoku_SolveOptions_T *options, Sudoku_Stats_T *stats);
+
+    /**
+     * @brief Starts a resumable solve with the search of Sudoku_Solve(). The root node is pruned.
+     *
+     * Independent tasks can be stepped alternately on one thread, so that the memory stalls and
+     * mispredicted branches of one search overlap with the work on the others.
+     *
+     * @param[out] task The task
+     * @param[in,out] p Pointer to a Sudoku puzzle structure, owned by the task until it completes
+     * @param[in] ws Workspace, owned by the task until it completes
+     * @param[in] options Options, NULL for the default branching without limits
+     * @return SUDOKU_RC_SUCCESS, or SUDOKU_RC_NULL_POINTER if a reference is NULL.
+     */
+    Sudoku_RC_T Sudoku_SolveBegin(Sudoku_SolveTask_T *task, SudokuPuzzle_P p, Sudoku_Workspace_T *ws, const Sudoku_SolveOptions_T *options);
+
+    /**
+     * @brief Advances a resumable solve by one branch or one backtrack.
+     *
+     * @param[in,out] task The task
+     * @return SUDOKU_RC_PRUNE while the search goes on, then the result of Sudoku_Solve() on every call.
+     */
+    Sudoku_RC_T Sudoku_SolveStep(Sudoku_SolveTask_T *task);
+
+    /**
+     * @brief Adds the statistics of a solve to a total: the maximum of max_level, the sum of the counters.
+     *
+     * @param[in,out] total Statistics to add to
+     * @param[in] stats Statistics of the solve
+     */
+    void Sudoku_AccumulateStats(Sudoku_Stats_T *total, const Sudoku_Stats_T *stats);
+
+    /**
+     * @brief Finds the cheapest logical deduction available in the puzzle.
+     *
+     * The candidates are derived from the cell values with the same unit masks as the pruner, and
+     * restricted by the candidates already removed from the puzzle. Techniques are tried in the order
+     * of @ref Sudoku_HintTechnique_T and the first deduction found is returned. The puzzle is not
+     * modified; use Sudoku_ApplyHint() to apply the deduction.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @param[out] hint The deduction
+     * @return SUDOKU_RC_SUCCESS if a deduction was found, or with SUDOKU_HINT_NONE if the puzzle is solved,
+     *         SUDOKU_RC_PRUNE if no supported technique applies (the puzzle needs search),
+     *         SUDOKU_RC_NOT_SOLVABLE with SUDOKU_HINT_CONTRADICTION if the puzzle is inconsistent,
+     *         SUDOKU_RC_NULL_POINTER if a reference is NULL.
+     */
+    Sudoku_RC_T Sudoku_NextHint(SudokuPuzzle_P p, Sudoku_Hint_T *hint);
+
+    /**
+     * @brief Applies a deduction found by Sudoku_NextHint().
+     *
+     * @param[in,out] p Pointer to a Sudoku puzzle structure
+     * @param[in] hint The deduction
+     * @return SUDOKU_RC_SUCCESS, SUDOKU_RC_NULL_POINTER, or SUDOKU_RC_INVALID_INPUT if the hint holds no deduction.
+     */
+    Sudoku_RC_T Sudoku_ApplyHint(SudokuPuzzle_P p, const Sudoku_Hint_T *hint);
+
+    /**
+     * @brief Human-readable name of a technique, e.g. "Hidden Single".
+     */
+    const char *Sudoku_HintName(Sudoku_HintTechnique_T technique);
+
 #ifdef __cplusplus
 }
 #endif
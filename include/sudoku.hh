@@ -12,21 +12,210 @@
 #define SUDOKU_HH_INCLUDED
 
 #include "sudoku.h"
+#include "sudoku_dataset.h"
+#include <atomic>
+#include <chrono>
 #include <string>
+#include <vector>
+
+/**
+ * @brief Search state of a single solve (configuration, cancellation and statistics).
+ */
+struct SudokuSearchContext;
+
+typedef struct Sudoku_Heuristic_S Sudoku_Heuristic_T;
+
+/**
+ * @brief Selects the branching candidate of a search node on behalf of a policy (see sudoku_heuristic.hh).
+ */
+typedef Sudoku_BitValues_T (*SudokuSelectFunction)(SudokuPuzzle_P p, const void *policy, uint32_t *rng_state, Sudoku_Row_Index_T &row, Sudoku_Column_Index_T &col);
+
+class SudokuTranspositionTable;
+
+/**
+ * @brief Options bounding the work of a single solve.
+ */
+struct SudokuSolveOptions
+{
+    /** Branching score, value ordering and random seed. */
+    Sudoku_SearchConfig_T config = {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, nullptr};
+    /** Maximum number of solve calls (search nodes). 0 means unlimited. */
+    unsigned long max_nodes = 0;
+    /** Wall-clock deadline. time_point::max() means no deadline. */
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    /** Optional external cancel token. The solve stops once it becomes true. */
+    const std::atomic<bool> *cancel = nullptr;
+    /** Optional table of dead states, see sudoku_transposition.hh. May be shared by concurrent solves. */
+    SudokuTranspositionTable *table = nullptr;
+    /** Propagation strength at every node. */
+    Sudoku_Propagation_T propagation = SUDOKU_PROPAGATE_SINGLES;
+    /** Candidates of bivalue cells probed per node, see Sudoku_ProbePuzzle(). 0 disables probing. */
+    unsigned int probe_budget = 0;
+};
+
+/**
+ * @brief Statistics of a single solve.
+ */
+struct SudokuSolveStats
+{
+    unsigned int max_level;    /**< Maximum recursion level reached. */
+    unsigned int solve_calls;  /**< Number of solve calls (search nodes). */
+    unsigned int backtracks;   /**< Number of branches that failed and were undone. */
+    unsigned int prune_sweeps; /**< Number of propagation passes over the grid. */
+    unsigned int table_probes; /**< Number of transposition table lookups. */
+    unsigned int table_hits;   /**< Number of lookups answered by the table. */
+    Sudoku_PropagationStats_T propagation; /**< Deductions of the techniques beyond naked singles. */
+};
+
+/**
+ * @brief Adds the statistics of a solve to a total: the maximum of max_level, the sum of the counters.
+ *
+ * @param total Statistics to add to.
+ * @param stats Statistics of the solve.
+ */
+void SudokuAccumulateStats(SudokuSolveStats &total, const SudokuSolveStats &stats);
+
+/**
+ * @brief Node limit schedule between restarts.
+ */
+typedef enum SudokuRestartSchedule_E
+{
+    SUDOKU_RESTART_LUBY = 0,  /**< base_nodes times the Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, ... (default) */
+    SUDOKU_RESTART_GEOMETRIC, /**< base_nodes times factor to the power of the restart index */
+} SudokuRestartSchedule_T;
+
+/**
+ * @brief Options of a solve with randomized restarts.
+ */
+struct SudokuRestartOptions
+{
+    /** Branching configuration, seed and overall node, time and cancellation budget. */
+    SudokuSolveOptions solve;
+    /** Node limit schedule. */
+    SudokuRestartSchedule_T schedule = SUDOKU_RESTART_LUBY;
+    /** Node limit of the first run. */
+    unsigned long base_nodes = 64;
+    /** Growth of the node limit per restart of the geometric schedule. */
+    double factor = 1.5;
+    /** Maximum number of restarts. The run after the last restart has no node limit of its own. 0 means unlimited. */
+    unsigned int max_restarts = 0;
+};
+
+/**
+ * @brief Statistics of one run of a solve with restarts.
+ */
+struct SudokuRestartRun
+{
+    uint32_t seed;          /**< Tie-breaking seed of the run. */
+    unsigned long limit;    /**< Node limit of the run, 0 for none. */
+    Sudoku_RC_T rc;         /**< Result of the run. */
+    SudokuSolveStats stats; /**< Nodes, backtracks, depth and prune sweeps of the run. */
+};
+
+/**
+ * @brief Statistics of a solve with restarts.
+ */
+struct SudokuRestartStats
+{
+    std::vector<SudokuRestartRun> runs; /**< Runs in order. All but the last one ended by their node limit. */
+    SudokuSolveStats total;             /**< Sums over the runs, maximum of the levels. */
+};
+
+/**
+ * @brief Result of a portfolio solve.
+ */
+struct SudokuPortfolioResult
+{
+    Sudoku_RC_T rc;               /**< Result code of the winning configuration. */
+    size_t winner;                /**< Index of the winning configuration. */
+    Sudoku_SearchConfig_T config; /**< The winning configuration. */
+    unsigned int max_level;       /**< Maximum recursion level reached by the winning configuration. */
+    unsigned int solve_calls;     /**< Number of solve calls of the winning configuration. */
+};
+
+/**
+ * @class SudokuPuzzleView
+ * @brief Read-only view of the cells of a puzzle, without copying.
+ *
+ * The view refers to the storage of the puzzle it was taken from, follows its changes and is
+ * valid as long as that puzzle exists at the same address. Cells are in row-major order.
+ */
+class SudokuPuzzleView
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param cells The 81 cells of a puzzle, see Sudoku_GetGrid().
+     */
+    explicit SudokuPuzzleView(const SudokuCell_S *cells) : cells(cells) {}
+
+    /**
+     * @brief Gets a cell.
+     */
+    const SudokuCell_S &Cell(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+    {
+        return cells[row * NUM_COLS + col];
+    }
+
+    /**
+     * @brief Gets the value mask of a cell.
+     */
+    uint32_t GetValueMask(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+    {
+        return Cell(row, col).value;
+    }
+
+    /**
+     * @brief Gets the raw candidate mask of a cell.
+     */
+    uint32_t GetCandidates(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+    {
+        return Cell(row, col).candidates;
+    }
+
+    /**
+     * @brief Gets the value of a cell, numbered as by SudokuPuzzle::GetValue().
+     */
+    Sudoku_Values_T GetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+    {
+        return Sudoku_MaskToValue(Cell(row, col).value);
+    }
+
+    const SudokuCell_S *begin(void) const
+    {
+        return cells;
+    }
+
+    const SudokuCell_S *end(void) const
+    {
+        return cells + NUM_ROWS * NUM_COLS;
+    }
+
+private:
+    const SudokuCell_S *cells;
+};
 
 /**
  * @class SudokuPuzzle
  * @brief A class representing a Sudoku puzzle with methods for initialization, solving, and manipulation.
+ *
+ * The puzzle state is stored inline and is trivially copyable: copies and moves are plain memory
+ * copies that never allocate, and containers of puzzles are contiguous.
  */
 class SudokuPuzzle
 {
 public:
     /**
-     * @brief Assignment operator for SudokuPuzzle class.
+     * @brief Assignment operator for SudokuPuzzle class. Copies in place, views of this puzzle stay valid.
      * @param other The SudokuPuzzle object to assign.
      * @return SudokuPuzzle& A reference to the assigned object.
      */
-    SudokuPuzzle &operator=(const SudokuPuzzle &other);
+    SudokuPuzzle &operator=(const SudokuPuzzle &other) noexcept = default;
+
+    /**
+     * @brief Move assignment operator, same as the copy.
+     */
+    SudokuPuzzle &operator=(SudokuPuzzle &&other) noexcept = default;
 
     /**
      * @brief Default constructor, creates an empty Sudoku puzzle.
@@ -43,12 +232,17 @@ public:
      * @brief Copy Constructor for SudokuPuzzle class.
      * @param other The SudokuPuzzle object to copy.
      */
-    SudokuPuzzle(const SudokuPuzzle &other);
+    SudokuPuzzle(const SudokuPuzzle &other) noexcept = default;
+
+    /**
+     * @brief Move Constructor, same as the copy.
+     */
+    SudokuPuzzle(SudokuPuzzle &&other) noexcept = default;
 
     /**
      * @brief Destructor for SudokuPuzzle class.
      */
-    ~SudokuPuzzle(void);
+    ~SudokuPuzzle(void) = default;
 
     /**
      * @brief Initializes a puzzle using a string notation.
@@ -57,6 +251,21 @@ public:
      */
     Sudoku_RC_T InitializePuzzle(const std::string &p);
 
+    /**
+     * @brief Initializes a puzzle from the first 81 characters of a buffer, without copying them.
+     * @param p The input puzzle in string notation, not necessarily null-terminated.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T InitializePuzzle(const char *p);
+
+    /**
+     * @brief Initializes the puzzle from a record of a binary dataset.
+     * @param dataset The dataset view.
+     * @param index The record index.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T InitializePuzzle(const Sudoku_Dataset_T &dataset, uint64_t index);
+
     /**
      * @brief Sets a value in the puzzle.
      * @param row The row index.
@@ -74,12 +283,175 @@ public:
      */
     Sudoku_Values_T GetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col);
 
+    /**
+     * @brief Gets the values of all cells in one call.
+     * @param values Receives the values in row-major order, numbered as by GetValue().
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T GetValues(int8_t (&values)[NUM_ROWS * NUM_COLS]) const;
+
+    /**
+     * @brief Gets the raw candidate masks of all cells in one call.
+     * @param masks Receives the candidate masks in row-major order.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T GetCandidateMasks(uint32_t (&masks)[NUM_ROWS * NUM_COLS]) const;
+
+    /**
+     * @brief Gets a read-only view of the cells, without copying.
+     * @return SudokuPuzzleView View valid as long as the puzzle exists and is not moved.
+     */
+    SudokuPuzzleView View(void) const;
+
     /**
      * @brief Solves the puzzle using pruning and backtracking.
      * @return Sudoku_RC_T The result code indicating success or failure.
      */
     Sudoku_RC_T Solve(void);
 
+    /**
+     * @brief Solves the puzzle using the selected engine.
+     * @param engine The solver engine to use.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T Solve(Sudoku_Engine_T engine);
+
+    /**
+     * @brief Solves the puzzle using pruning and backtracking with a custom search configuration.
+     * @param config Branching score, value ordering and random seed to use.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T Solve(const Sudoku_SearchConfig_T &config);
+
+    /**
+     * @brief Solves the puzzle within a node, time and cancellation budget.
+     *
+     * When the budget runs out the search stops with SUDOKU_RC_BUDGET_EXHAUSTED (node count or deadline)
+     * or SUDOKU_RC_CANCELLED (cancel token). The puzzle then holds the deductions proven so far: the
+     * pruned candidates and the candidates eliminated by refuted branches. It stays consistent and can be
+     * solved again to resume the work.
+     *
+     * @param options Search configuration and budgets.
+     * @param stats Optional statistics of this solve, also filled when the budget ran out.
+     * @return Sudoku_RC_T The result code indicating success, failure or an exhausted budget.
+     */
+    Sudoku_RC_T Solve(const SudokuSolveOptions &options, SudokuSolveStats *stats = nullptr);
+
+    /**
+     * @brief Solves the puzzle with randomized tie-breaking, restarting the search when a run exceeds its node limit.
+     *
+     * An early bad branching decision can cost orders of magnitude more nodes than the puzzle needs.
+     * Restarting with another tie-breaking order after a growing number of nodes bounds that cost.
+     * Each run derives its seed from the configured seed and its index, so the runs, the result
+     * and the statistics are reproducible for a given seed. Candidates refuted by a run stay
+     * eliminated for the following runs.
+     *
+     * @param options Restart schedule and overall budget.
+     * @param stats Optional statistics of every run.
+     * @return Sudoku_RC_T The result code of the last run, SUDOKU_RC_BUDGET_EXHAUSTED if the overall
+     *         node or time budget ran out, or SUDOKU_RC_CANCELLED.
+     */
+    Sudoku_RC_T SolveWithRestarts(const SudokuRestartOptions &options, SudokuRestartStats *stats = nullptr);
+
+    /**
+     * @brief Node limit of a run of a restart schedule.
+     *
+     * @param options Schedule, base node limit and factor.
+     * @param run Index of the run, starting at 0.
+     * @return unsigned long Node limit of the run.
+     */
+    static unsigned long RestartLimit(const SudokuRestartOptions &options, unsigned int run);
+
+    /**
+     * @brief Solves the puzzle, branching with a heuristic table (see sudoku_heuristic.h).
+     *
+     * Same as Solve(const SudokuSolveOptions &, SudokuSolveStats *) with the heuristic set in the
+     * search configuration of default options.
+     *
+     * @param heuristic Cell scoring and value ordering functions, e.g. an entry of Sudoku_Heuristics.
+     * @param stats Optional statistics of this solve (nodes, backtracks and maximum level).
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T Solve(const Sudoku_Heuristic_T &heuristic, SudokuSolveStats *stats = nullptr);
+
+    /**
+     * @brief Solves the puzzle, branching with a heuristic policy resolved at compile time.
+     *
+     * Defined in sudoku_heuristic.hh, which also provides the policies of the built-in heuristics.
+     * The policy replaces the score and ordering of the search configuration, ties are broken with its
+     * seed; budgets, cancellation, transposition table, propagation and probing of the options apply as for
+     * Solve(const SudokuSolveOptions &, SudokuSolveStats *).
+     *
+     * @param policy Policy scoring cells and ordering values.
+     * @param options Budgets, cancellation, table and propagation of the solve.
+     * @param stats Optional statistics of this solve (nodes, backtracks and maximum level).
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    template <class Policy>
+    Sudoku_RC_T SolveWith(const Policy &policy, const SudokuSolveOptions &options, SudokuSolveStats *stats = nullptr);
+
+    /**
+     * @brief Solves the puzzle with default options, branching with a heuristic policy.
+     */
+    template <class Policy>
+    Sudoku_RC_T SolveWith(const Policy &policy, SudokuSolveStats *stats = nullptr)
+    {
+        return SolveWith(policy, SudokuSolveOptions(), stats);
+    }
+
+    /**
+     * @brief Solves the puzzle by racing several search configurations in parallel.
+     *
+     * Each configuration solves its own copy of the puzzle in a separate thread. The first
+     * configuration to reach a result wins and cancels the others; its puzzle state is
+     * copied into this puzzle.
+     *
+     * @param result Result code, winning configuration and statistics of the winner.
+     * @param configs Configurations to race. Must not be empty.
+     * @param table Optional table of dead states shared by the racing configurations.
+     * @return Sudoku_RC_T The result code of the winning configuration, or SUDOKU_RC_INVALID_INPUT.
+     */
+    Sudoku_RC_T SolvePortfolio(SudokuPortfolioResult &result, const std::vector<Sudoku_SearchConfig_T> &configs = DefaultPortfolio(),
+                               SudokuTranspositionTable *table = nullptr);
+
+    /**
+     * @brief Default portfolio of search configurations.
+     * @return std::vector<Sudoku_SearchConfig_T> Configurations with different scores, orderings and seeds.
+     */
+    static std::vector<Sudoku_SearchConfig_T> DefaultPortfolio(void);
+
+    /**
+     * @brief Counts the solutions of the puzzle without modifying it.
+     *
+     * The search stops as soon as @p limit solutions have been found, so a limit of 2
+     * is enough to check whether a puzzle has a unique solution.
+     *
+     * @param count The number of solutions found (at most @p limit).
+     * @param limit The maximum number of solutions to count.
+     * @param engine The solver engine to use.
+     * @param table Optional table of subtree counts, used by the pruning engine. Subtrees counted
+     *              completely are stored with their number of solutions and answered from the table
+     *              when reached again, also by later counts sharing the table.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS if there is at least one solution, SUDOKU_RC_ERROR otherwise.
+     */
+    Sudoku_RC_T CountSolutions(unsigned long &count, unsigned long limit, Sudoku_Engine_T engine = SUDOKU_ENGINE_PRUNE,
+                               SudokuTranspositionTable *table = nullptr);
+
+    /**
+     * @brief Finds the cheapest logical deduction available in the puzzle, without modifying it.
+     * @param hint The technique, the cells it is based on and the placed value or the eliminated candidates.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS if a deduction was found, SUDOKU_RC_PRUNE if the puzzle needs
+     *         search, or SUDOKU_RC_NOT_SOLVABLE if the puzzle is inconsistent. See Sudoku_NextHint().
+     */
+    Sudoku_RC_T NextHint(Sudoku_Hint_T &hint);
+
+    /**
+     * @brief Applies a deduction found by NextHint().
+     * @param hint The deduction.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T ApplyHint(const Sudoku_Hint_T &hint);
+
     /**
      *  @brief Get the Sudoku puzzle as a string.
      * This method constructs a string representation of the current Sudoku puzzle.
@@ -92,10 +464,17 @@ public:
      */
     std::string GetPuzzleAsString(void);
 
+    /**
+     * @brief Gets the Zobrist hash of the cell values. See Sudoku_GetHash().
+     */
+    uint64_t GetHash(void) const;
+
 
     Sudoku_RC_T Check(void);
 
 private:
+    friend class SudokuSolutionCache;
+
     /**
      * @brief Constructor, creates a new Sudoku puzzle object.
      * @param p A pointer to an existing SudokuPuzzle_S object.
@@ -142,14 +521,36 @@ private:
      * @brief Recursively solves the Sudoku Puzzle using pruning and backtracking.
      *
      * @param level Level of recursion.
+     * @param ctx Search configuration, cancellation and statistics.
      * @return Sudoku_RC_T Result code.
      */
-    Sudoku_RC_T Solve(unsigned int level);
+    Sudoku_RC_T Solve(unsigned int level, SudokuSearchContext &ctx);
+
+    /**
+     * @brief Solves the puzzle with options, selecting the branching candidates with @p select if not null.
+     *
+     * @param options Search configuration, budgets, cancellation, table and propagation.
+     * @param stats Optional statistics of this solve.
+     * @param select Selection of a policy, or nullptr to select with the search configuration.
+     * @param policy Passed to @p select.
+     * @return Sudoku_RC_T Result code.
+     */
+    Sudoku_RC_T Solve(const SudokuSolveOptions &options, SudokuSolveStats *stats, SudokuSelectFunction select, const void *policy);
+
+    /**
+     * @brief Recursively counts the solutions of the Sudoku Puzzle using pruning and backtracking.
+     *
+     * @param level Level of recursion.
+     * @param limit Maximum number of solutions to count.
+     * @param count Number of solutions found so far.
+     * @param table Optional table of subtree counts.
+     */
+    void Count(unsigned int level, unsigned long limit, unsigned long &count, SudokuTranspositionTable *table);
 
     /**
-     * @brief A pointer to the Sudoku Puzzle structure.
+     * @brief The Sudoku Puzzle structure.
      */
-    SudokuPuzzle_P puzzle;
+    struct SudokuPuzzle_S puzzle;
 };
 
 unsigned int GetMaxLevel(void);
@@ -0,0 +1,204 @@
+/**
+ * @file sudoku_arena.hh
+ * @brief Per-thread arena for batch workloads
+ *
+ * Memory a caller needs for one batch only, such as read buffers, parsed puzzles and result
+ * buffers, is bump-allocated from the arena and released at once by Reset(). Once the arena has
+ * grown to the size of a batch, later batches of the same size do not call the global allocator
+ * for it; the counters make that observable. The library does not allocate from arenas itself:
+ * the search engines keep their per-thread workspaces for the lifetime of the thread.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_ARENA_HH_INCLUDED
+#define SUDOKU_ARENA_HH_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @class SudokuArena
+ * @brief Bump allocator over a list of chunks, released in constant time.
+ *
+ * Memory is never returned to the global allocator before destruction: Reset() rewinds to the
+ * first chunk and later allocations reuse the chunks of earlier batches. Objects are not
+ * destroyed by Reset(), so only trivially destructible objects (puzzles, workspaces, plain
+ * buffers) or containers using SudokuArenaAllocator should be placed in an arena.
+ * Not thread-safe; use one arena per thread, e.g. ThreadLocal().
+ */
+class SudokuArena
+{
+public:
+    /**
+     * @brief Constructor. No memory is allocated before the first allocation.
+     * @param chunk_size Size of the chunks requested from the global allocator, in bytes.
+     *                   Larger allocations get a chunk of their own.
+     */
+    explicit SudokuArena(size_t chunk_size = 1 << 20);
+
+    ~SudokuArena(void);
+
+    SudokuArena(const SudokuArena &) = delete;
+    SudokuArena &operator=(const SudokuArena &) = delete;
+
+    /**
+     * @brief Allocates memory valid until the next Reset().
+     * @param size Size in bytes.
+     * @param alignment Power of two alignment.
+     * @return The memory. Throws std::bad_alloc if the global allocator fails.
+     */
+    void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Allocates and constructs an object.
+     */
+    template <class T, class... Args>
+    T *New(Args &&...args)
+    {
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Allocates an array of default-initialized elements.
+     */
+    template <class T>
+    T *NewArray(size_t n)
+    {
+        return new (Allocate(n * sizeof(T), alignof(T))) T[n];
+    }
+
+    /**
+     * @brief Releases all allocations in constant time, keeping the chunks for reuse.
+     */
+    void Reset(void);
+
+    /**
+     * @brief Number of allocations served since construction.
+     */
+    size_t Allocations(void) const
+    {
+        return n_allocations;
+    }
+
+    /**
+     * @brief Number of chunks requested from the global allocator since construction.
+     */
+    size_t UpstreamAllocations(void) const
+    {
+        return n_upstream;
+    }
+
+    /**
+     * @brief Number of calls to Reset().
+     */
+    size_t Resets(void) const
+    {
+        return n_resets;
+    }
+
+    /**
+     * @brief Bytes allocated since the last Reset(), including alignment padding.
+     */
+    size_t BytesInUse(void) const
+    {
+        return bytes_in_use;
+    }
+
+    /**
+     * @brief Total size of the chunks owned by the arena.
+     */
+    size_t Capacity(void) const
+    {
+        return capacity;
+    }
+
+    /**
+     * @brief Arena of the calling thread, created on first use.
+     */
+    static SudokuArena &ThreadLocal(void);
+
+private:
+    struct Chunk
+    {
+        Chunk *next; /**< Next chunk, reused after a reset. */
+        size_t size; /**< Usable bytes after the header. */
+    };
+
+    static char *Begin(Chunk *chunk)
+    {
+        return reinterpret_cast<char *>(chunk) + sizeof(Chunk);
+    }
+
+    /**
+     * @brief Moves to the next chunk able to hold an allocation, requesting one if needed.
+     */
+    void NextChunk(size_t size, size_t alignment);
+
+    size_t chunk_size;
+    Chunk *first = nullptr;
+    Chunk *current = nullptr;
+    char *cursor = nullptr;
+    char *limit = nullptr;
+
+    size_t n_allocations = 0;
+    size_t n_upstream = 0;
+    size_t n_resets = 0;
+    size_t bytes_in_use = 0;
+    size_t capacity = 0;
+};
+
+/**
+ * @brief Standard allocator drawing from a SudokuArena. Deallocation is a no-op.
+ */
+template <class T>
+class SudokuArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit SudokuArenaAllocator(SudokuArena &arena = SudokuArena::ThreadLocal()) noexcept : arena(&arena) {}
+
+    template <class U>
+    SudokuArenaAllocator(const SudokuArenaAllocator<U> &other) noexcept : arena(other.arena)
+    {
+    }
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, size_t) noexcept
+    {
+    }
+
+    template <class U>
+    bool operator==(const SudokuArenaAllocator<U> &other) const noexcept
+    {
+        return arena == other.arena;
+    }
+
+    template <class U>
+    bool operator!=(const SudokuArenaAllocator<U> &other) const noexcept
+    {
+        return arena != other.arena;
+    }
+
+private:
+    template <class U>
+    friend class SudokuArenaAllocator;
+
+    SudokuArena *arena;
+};
+
+/**
+ * @brief Vector whose storage is allocated from an arena.
+ */
+template <class T>
+using SudokuArenaVector = std::vector<T, SudokuArenaAllocator<T>>;
+
+#endif // SUDOKU_ARENA_HH_INCLUDED
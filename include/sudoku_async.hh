@@ -0,0 +1,165 @@
+/**
+ * @file sudoku_async.hh
+ * @brief Asynchronous solve API on a shared executor
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_ASYNC_HH_INCLUDED
+#define SUDOKU_ASYNC_HH_INCLUDED
+
+#include "sudoku.hh"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class SudokuExecutor
+ * @brief Fixed pool of worker threads running queued tasks in submission order.
+ */
+class SudokuExecutor
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param n_threads Number of worker threads. 0 uses the number of hardware threads.
+     */
+    explicit SudokuExecutor(unsigned int n_threads = 0);
+
+    /**
+     * @brief Runs the tasks still queued, then stops the worker threads.
+     */
+    ~SudokuExecutor(void);
+
+    SudokuExecutor(const SudokuExecutor &) = delete;
+    SudokuExecutor &operator=(const SudokuExecutor &) = delete;
+
+    /**
+     * @brief Queues a task.
+     */
+    void Submit(std::function<void(void)> task);
+
+    /**
+     * @brief Executor shared by all asynchronous solves that do not name one.
+     */
+    static SudokuExecutor &Shared(void);
+
+private:
+    void Run(void);
+
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::deque<std::function<void(void)>> tasks;
+    std::vector<std::thread> threads;
+    bool stopping;
+};
+
+/**
+ * @brief Shared state of an asynchronous solve.
+ */
+struct SudokuSolveState;
+
+/**
+ * @brief Completion callback, called with the result code and the solved (or partially solved) puzzle.
+ *
+ * The puzzle is shared by all callbacks and handles of the solve and must not be modified; copy it to work on it.
+ */
+typedef std::function<void(Sudoku_RC_T rc, const SudokuPuzzle &puzzle)> SudokuSolveCallback;
+
+/**
+ * @class SudokuSolveHandle
+ * @brief Future-like handle of an asynchronous solve.
+ *
+ * Handles are cheap to copy; all copies refer to the same solve.
+ */
+class SudokuSolveHandle
+{
+public:
+    SudokuSolveHandle(void) = default;
+
+    /**
+     * @brief Checks whether the solve has completed.
+     */
+    bool Ready(void) const;
+
+    /**
+     * @brief Blocks until the solve has completed.
+     * @return Sudoku_RC_T The result code of the solve.
+     */
+    Sudoku_RC_T Wait(void) const;
+
+    /**
+     * @brief Blocks until the solve has completed or the timeout expires.
+     * @return true if the solve has completed.
+     */
+    bool WaitFor(std::chrono::steady_clock::duration timeout) const;
+
+    /**
+     * @brief Waits for the solve and copies the resulting puzzle.
+     * @param puzzle Receives the solved (or partially solved) puzzle.
+     * @return Sudoku_RC_T The result code of the solve.
+     */
+    Sudoku_RC_T Get(SudokuPuzzle &puzzle) const;
+
+    /**
+     * @brief Statistics of the completed solve.
+     */
+    SudokuSolveStats Stats(void) const;
+
+    /**
+     * @brief Requests cancellation. A queued solve completes without searching, a running one
+     *        stops at its next search node. Both complete with SUDOKU_RC_CANCELLED.
+     */
+    void Cancel(void);
+
+    /**
+     * @brief Registers a completion callback.
+     *
+     * The callback runs on the executor thread that completed the solve, or immediately on the
+     * calling thread if the solve has already completed.
+     */
+    void Then(SudokuSolveCallback callback);
+
+    /**
+     * @brief Registers a completion callback unless the solve has already completed.
+     *
+     * @return true if the callback was registered and will run on the executor thread, false if
+     *         the solve has already completed; the callback is then not called.
+     */
+    bool ThenIfPending(SudokuSolveCallback callback);
+
+    /**
+     * @brief Checks whether the handle refers to a solve.
+     */
+    bool Valid(void) const;
+
+private:
+    friend SudokuSolveHandle SolveAsync(const SudokuPuzzle &, const SudokuSolveOptions &, SudokuExecutor &);
+
+    explicit SudokuSolveHandle(std::shared_ptr<SudokuSolveState> state);
+
+    std::shared_ptr<SudokuSolveState> state;
+};
+
+/**
+ * @brief Solves a copy of a puzzle on an executor.
+ *
+ * The cancel token of @p options is replaced by the token of the returned handle; the node
+ * and deadline budgets apply as with SudokuPuzzle::Solve(const SudokuSolveOptions &, SudokuSolveStats *).
+ *
+ * @param puzzle The puzzle to solve. It is copied and not modified.
+ * @param options Search configuration and budgets.
+ * @param executor Executor running the solve.
+ * @return SudokuSolveHandle Handle of the solve.
+ */
+SudokuSolveHandle SolveAsync(const SudokuPuzzle &puzzle, const SudokuSolveOptions &options = SudokuSolveOptions(),
+                             SudokuExecutor &executor = SudokuExecutor::Shared());
+
+#endif // SUDOKU_ASYNC_HH_INCLUDED
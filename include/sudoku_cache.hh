@@ -0,0 +1,159 @@
+/**
+ * @file sudoku_cache.hh
+ * @brief Canonical-form symmetry hashing and in-process solution cache
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_CACHE_HH_INCLUDED
+#define SUDOKU_CACHE_HH_INCLUDED
+
+#include "sudoku.hh"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 81 characters ('0' for empty cells, '1'-'9' for values) in row-major order.
+ */
+typedef std::array<char, NUM_ROWS * NUM_COLS> SudokuGridKey;
+
+/**
+ * @brief Validity preserving transformation mapping a puzzle to its canonical form.
+ *
+ * Canonical cell (i, j) holds the value of cell (rows[i], cols[j]) of the original puzzle,
+ * or of cell (cols[j], rows[i]) if the puzzle is transposed. Original value v becomes digits[v].
+ */
+struct SudokuTransform
+{
+    bool transpose;                       /**< Transpose the puzzle before permuting. */
+    uint8_t rows[NUM_ROWS];               /**< Original row of each canonical row. */
+    uint8_t cols[NUM_COLS];               /**< Original column of each canonical column. */
+    uint8_t digits[NUM_CANDIDATES + 1];   /**< Canonical value of each original value. digits[0] is 0. */
+};
+
+/**
+ * @brief Computes the canonical form of a puzzle under the Sudoku symmetry group.
+ *
+ * The canonical form is the lexicographically smallest grid reachable through transposition,
+ * band and stack permutations, row and column permutations within bands and stacks, and digit
+ * relabelling (digits are numbered in order of first appearance), among the grids whose bands,
+ * stacks, rows and columns are in ascending order of their clue counts and whose rows have no
+ * larger clue count profile than their columns. Puzzles that are copies of each other under these
+ * symmetries share the same key.
+ *
+ * @param p The puzzle to canonicalize.
+ * @param key The canonical key.
+ * @param transform The transformation from the puzzle to its canonical form.
+ * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_NULL_POINTER, or SUDOKU_RC_ERROR
+ *         if the puzzle has fewer than 17 clues or is too symmetric to canonicalize within the search limit.
+ */
+Sudoku_RC_T Sudoku_Canonicalize(const struct SudokuPuzzle_S *p, SudokuGridKey &key, SudokuTransform &transform);
+
+/**
+ * @brief Maps the values of a puzzle into canonical space.
+ *
+ * @param p The puzzle, typically solved.
+ * @param transform Transformation returned by Sudoku_Canonicalize() for the puzzle.
+ * @param values The transformed values.
+ * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_NULL_POINTER.
+ */
+Sudoku_RC_T Sudoku_ApplyTransform(SudokuPuzzle_P p, const SudokuTransform &transform, SudokuGridKey &values);
+
+/**
+ * @brief Maps canonical values back onto a puzzle.
+ *
+ * @param values Values in canonical space, e.g. a cached solution.
+ * @param transform Transformation returned by Sudoku_Canonicalize() for the puzzle.
+ * @param p The puzzle to write into.
+ * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_NULL_POINTER.
+ */
+Sudoku_RC_T Sudoku_ApplyInverseTransform(const SudokuGridKey &values, const SudokuTransform &transform, SudokuPuzzle_P p);
+
+/**
+ * @class SudokuSolutionCache
+ * @brief Sharded, thread-safe LRU cache of solutions keyed by canonical puzzle form.
+ *
+ * Solutions are stored in canonical space, so relabelled, transposed or permuted copies of a
+ * solved puzzle are answered from the cache without searching.
+ */
+class SudokuSolutionCache
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param capacity Maximum number of cached solutions.
+     * @param n_shards Number of independently locked shards.
+     */
+    explicit SudokuSolutionCache(size_t capacity = 1 << 16, size_t n_shards = 16);
+
+    /**
+     * @brief Solves a puzzle, answering from the cache when an equivalent puzzle was solved before.
+     *
+     * Puzzles that cannot be canonicalized are solved directly and not cached.
+     *
+     * @param puzzle The puzzle to solve.
+     * @param engine The solver engine used on a cache miss.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T Solve(SudokuPuzzle &puzzle, Sudoku_Engine_T engine = SUDOKU_ENGINE_PRUNE);
+
+    /**
+     * @brief Computes the canonical key of a puzzle object. See Sudoku_Canonicalize().
+     */
+    static Sudoku_RC_T Canonicalize(const SudokuPuzzle &puzzle, SudokuGridKey &key, SudokuTransform &transform);
+
+    /**
+     * @brief Looks up the canonical solution of a canonical key.
+     * @return true if the key is cached.
+     */
+    bool Lookup(const SudokuGridKey &key, SudokuGridKey &solution);
+
+    /**
+     * @brief Stores the canonical solution of a canonical key, evicting the least recently used entry of the shard if full.
+     */
+    void Insert(const SudokuGridKey &key, const SudokuGridKey &solution);
+
+    /**
+     * @brief Removes all entries and resets the statistics.
+     */
+    void Clear(void);
+
+    size_t Size(void) const;
+    unsigned long Hits(void) const;
+    unsigned long Misses(void) const;
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const SudokuGridKey &key) const;
+    };
+
+    struct Entry
+    {
+        SudokuGridKey key;
+        SudokuGridKey solution;
+    };
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<SudokuGridKey, std::list<Entry>::iterator, KeyHash> index;
+    };
+
+    Shard &GetShard(const SudokuGridKey &key);
+
+    size_t shard_capacity;
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<unsigned long> hits;
+    std::atomic<unsigned long> misses;
+};
+
+#endif // SUDOKU_CACHE_HH_INCLUDED
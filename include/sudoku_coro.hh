@@ -0,0 +1,68 @@
+/**
+ * @file sudoku_coro.hh
+ * @brief C++20 coroutine support for asynchronous solves
+ *
+ * Header-only and kept apart from the library, which builds as C++14. Include it from
+ * translation units compiled as C++20.
+ *
+ * @code
+ * Task Solve(SudokuPuzzle puzzle)
+ * {
+ *     SudokuSolveHandle handle = SolveAsync(puzzle);
+ *     Sudoku_RC_T rc = co_await handle;
+ *     ...
+ * }
+ * @endcode
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_CORO_HH_INCLUDED
+#define SUDOKU_CORO_HH_INCLUDED
+
+#include "sudoku_async.hh"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+
+/**
+ * @brief Awaitable of an asynchronous solve.
+ *
+ * The awaiting coroutine is resumed on the executor thread that completed the solve, or
+ * continues immediately if the solve has already completed.
+ */
+class SudokuSolveAwaitable
+{
+public:
+    explicit SudokuSolveAwaitable(SudokuSolveHandle handle) : handle(std::move(handle)) {}
+
+    bool await_ready(void) const
+    {
+        return handle.Ready();
+    }
+
+    bool await_suspend(std::coroutine_handle<> continuation)
+    {
+        /* A solve completed since await_ready() continues without suspending, not by a nested resume */
+        return handle.ThenIfPending([continuation](Sudoku_RC_T, const SudokuPuzzle &)
+                                    { continuation.resume(); });
+    }
+
+    Sudoku_RC_T await_resume(void) const
+    {
+        return handle.Wait();
+    }
+
+private:
+    SudokuSolveHandle handle;
+};
+
+inline SudokuSolveAwaitable operator co_await(SudokuSolveHandle handle)
+{
+    return SudokuSolveAwaitable(std::move(handle));
+}
+
+#endif
+
+#endif // SUDOKU_CORO_HH_INCLUDED
@@ -0,0 +1,113 @@
+/**
+ * @file sudoku_dataset.h
+ * @brief Bit-packed binary puzzle dataset format
+ *
+ * A dataset is a 32-byte header followed by fixed-size records, so record @c i starts at
+ * byte @c 32 + i * record_size. This gives O(1) random access and lets workers shard a
+ * dataset by index. All multi-byte header fields are little endian.
+ *
+ * Record encodings:
+ * - Nibbles: 41 bytes, one 4-bit value per cell in row-major order, low nibble first (0 for empty cells).
+ * - Givens: an 81-bit mask of the given cells (11 bytes) followed by the 4-bit values of the
+ *   givens in row-major order. The record size depends on the largest number of givens in the dataset.
+ *
+ * With @ref SUDOKU_DATASET_FLAG_SOLUTION each record is followed by the solution in nibble encoding.
+ * A solution made of zeros marks a puzzle without known solution.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_DATASET_H_INCLUDED
+#define SUDOKU_DATASET_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "sudoku.h"
+
+#define SUDOKU_DATASET_HEADER_SIZE 32
+#define SUDOKU_DATASET_VERSION 1
+#define SUDOKU_DATASET_NIBBLES_SIZE ((NUM_ROWS * NUM_COLS + 1) / 2)  /**< Size of a nibble encoded grid. */
+#define SUDOKU_DATASET_GIVENS_MASK_SIZE ((NUM_ROWS * NUM_COLS + 7) / 8) /**< Size of the givens mask. */
+
+#define SUDOKU_DATASET_FLAG_GIVENS ((uint32_t)1 << 0)   /**< Records use the givens-mask-plus-values encoding. */
+#define SUDOKU_DATASET_FLAG_SOLUTION ((uint32_t)1 << 1) /**< Records carry the solution. */
+
+    /**
+     * @brief View of a binary dataset held in memory (e.g. read or memory-mapped from a file).
+     */
+    typedef struct Sudoku_Dataset_S
+    {
+        const uint8_t *records; /**< First record. */
+        uint64_t count;         /**< Number of records. */
+        uint32_t flags;         /**< SUDOKU_DATASET_FLAG_* */
+        uint32_t record_size;   /**< Size of a record in bytes, including the solution. */
+        uint32_t max_givens;    /**< Capacity of the givens encoding. */
+    } Sudoku_Dataset_T;
+
+    /**
+     * @brief Computes the size of a record.
+     *
+     * @param flags Dataset flags.
+     * @param max_givens Largest number of givens of a puzzle (only used by the givens encoding).
+     * @return size_t Record size in bytes.
+     */
+    size_t Sudoku_Dataset_RecordSize(uint32_t flags, unsigned int max_givens);
+
+    /**
+     * @brief Writes a dataset header.
+     *
+     * @param header Buffer of SUDOKU_DATASET_HEADER_SIZE bytes.
+     * @param flags Dataset flags.
+     * @param count Number of records.
+     * @param max_givens Largest number of givens of a puzzle (0 to 81).
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, SUDOKU_RC_NULL_POINTER or SUDOKU_RC_INVALID_INPUT.
+     */
+    Sudoku_RC_T Sudoku_Dataset_WriteHeader(uint8_t *header, uint32_t flags, uint64_t count, unsigned int max_givens);
+
+    /**
+     * @brief Encodes a puzzle in array notation into a record.
+     *
+     * @param dataset Dataset the record belongs to (flags and max_givens are used).
+     * @param record Buffer of dataset->record_size bytes.
+     * @param puzzle Puzzle in array notation (81 characters, '1'-'9' for givens).
+     * @param solution Solution in array notation, or NULL if unknown. Ignored without SUDOKU_DATASET_FLAG_SOLUTION.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, SUDOKU_RC_NULL_POINTER or SUDOKU_RC_INVALID_INPUT
+     *         if the puzzle has more than max_givens givens.
+     */
+    Sudoku_RC_T Sudoku_Dataset_EncodeRecord(const Sudoku_Dataset_T *dataset, uint8_t *record, const char *puzzle, const char *solution);
+
+    /**
+     * @brief Opens a dataset view over a buffer. The buffer is not copied and must outlive the view.
+     *
+     * @param dataset Dataset view to initialize.
+     * @param data Header and records.
+     * @param size Size of the buffer in bytes.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, SUDOKU_RC_NULL_POINTER or SUDOKU_RC_INVALID_INPUT
+     *         if the header is invalid or the buffer is too small for the records.
+     */
+    Sudoku_RC_T Sudoku_Dataset_Open(Sudoku_Dataset_T *dataset, const void *data, size_t size);
+
+    /**
+     * @brief Loads a record into puzzle objects.
+     *
+     * The givens are placed directly into the candidate masks of the puzzle, as with
+     * Sudoku_InitializeFromArray().
+     *
+     * @param dataset Dataset view.
+     * @param index Record index.
+     * @param puzzle Puzzle to initialize.
+     * @param solution Puzzle to initialize with the solution, or NULL.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, SUDOKU_RC_NULL_POINTER, SUDOKU_RC_INVALID_INPUT if the
+     *         index is out of range or the dataset carries no solutions, SUDOKU_RC_INVALID_VALUE for a
+     *         corrupt record, or SUDOKU_RC_NOT_SOLVABLE if the solution of the record is unknown.
+     */
+    Sudoku_RC_T Sudoku_Dataset_Read(const Sudoku_Dataset_T *dataset, uint64_t index, SudokuPuzzle_P puzzle, SudokuPuzzle_P solution);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SUDOKU_DATASET_H_INCLUDED
@@ -0,0 +1,276 @@
+/**
+ * @file sudoku_heuristic.h
+ * @brief Pluggable branching and value-ordering heuristics
+ *
+ * Before each branching decision, Sudoku_PrepareSelection() summarizes the open cells of the
+ * puzzle in a @ref Sudoku_Selection_T. A heuristic scores every open cell and orders the candidate
+ * values of the best cells; the cell with the lowest score wins, ties go to the value with the
+ * lowest order key, and remaining ties to the first cell in row-major order, or to a random one
+ * if the search has a seed (Sudoku_SelectionOffer()).
+ *
+ * Heuristics are plugged in either as a table of function pointers (@ref Sudoku_Heuristic_T) or,
+ * from C++, as a policy class (see sudoku_heuristic.hh) that the compiler inlines. The scoring
+ * functions of the built-in heuristics are defined inline below so both forms share them, and
+ * the score and order of a @ref Sudoku_SearchConfig_T select among the same functions
+ * (@ref Sudoku_BranchScores, @ref Sudoku_ValueOrders). Sudoku_SelectCandidateUsingConfig() is the
+ * selection loop of every search.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_HEURISTIC_H_INCLUDED
+#define SUDOKU_HEURISTIC_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "sudoku.h"
+
+    /**
+     * @brief An open cell, with its candidates and the number of values missing in its units.
+     */
+    typedef struct Sudoku_CellInfo_S
+    {
+        uint8_t row;          /**< Row index. */
+        uint8_t col;          /**< Column index. */
+        uint8_t sub;          /**< Subgrid index (0-8, row-major). */
+        uint8_t n_candidates; /**< Number of candidates of the cell. */
+        uint8_t n_row_empty;  /**< Values missing in the row. */
+        uint8_t n_col_empty;  /**< Values missing in the column. */
+        uint8_t n_sub_empty;  /**< Values missing in the subgrid. */
+        uint32_t candidates;  /**< Candidate mask. */
+    } Sudoku_CellInfo_T;
+
+    /**
+     * @brief Summary of the open cells of a puzzle, taken before a branching decision.
+     */
+    typedef struct Sudoku_Selection_S
+    {
+        Sudoku_CellInfo_T cells[NUM_ROWS * NUM_COLS];   /**< Open cells in row-major order. */
+        unsigned int n_cells;                           /**< Number of open cells. */
+        uint8_t value_counts[NUM_CANDIDATES];           /**< Open cells holding each value as candidate. */
+        uint8_t unit_value_counts[27][NUM_CANDIDATES];  /**< Same, per row (0-8), column (9-17) and subgrid (18-26). */
+    } Sudoku_Selection_T;
+
+    /**
+     * @brief Score of an open cell. Lower is branched on first.
+     */
+    typedef uint32_t (*Sudoku_ScoreFunction_T)(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, void *user);
+
+    /**
+     * @brief Order key of a candidate value (0-8) of a cell. Lower is tried first.
+     */
+    typedef uint32_t (*Sudoku_OrderFunction_T)(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value, void *user);
+
+    /**
+     * @brief Branching heuristic as a table of function pointers.
+     */
+    typedef struct Sudoku_Heuristic_S
+    {
+        const char *name;             /**< Short name, e.g. for reports. */
+        Sudoku_ScoreFunction_T score; /**< Cell scoring. */
+        Sudoku_OrderFunction_T order; /**< Value ordering. */
+        void *user;                   /**< Passed to the functions. */
+    } Sudoku_Heuristic_T;
+
+    /**
+     * @brief Best candidate of a selection so far.
+     */
+    typedef struct Sudoku_SelectionBest_S
+    {
+        uint32_t score;      /**< Score of the best cell, UINT32_MAX before the first candidate. */
+        uint32_t order;      /**< Order key of the best value. */
+        uint32_t n_ties;     /**< Candidates seen with the same score and order key. */
+        uint32_t *rng_state; /**< Random tie-breaking state (xorshift32, not 0), NULL keeps the first candidate. */
+    } Sudoku_SelectionBest_T;
+
+    /**
+     * @brief Offers a candidate to a selection, in row-major and ascending value order.
+     *
+     * The lower score wins, then the lower order key. Ties keep the first candidate or, with a
+     * random state, each tied candidate with equal probability (reservoir sampling).
+     *
+     * @return Nonzero if the candidate is the new best one.
+     */
+    static inline int Sudoku_SelectionOffer(Sudoku_SelectionBest_T *best, uint32_t score, uint32_t order)
+    {
+        if ((score < best->score) || ((score == best->score) && (order < best->order)))
+        {
+            best->n_ties = 1;
+        }
+        else if ((score != best->score) || (order != best->order) || (NULL == best->rng_state))
+        {
+            return 0;
+        }
+        else
+        {
+            uint32_t x = *best->rng_state;
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            *best->rng_state = x;
+
+            if (0 != (x % ++best->n_ties))
+            {
+                return 0;
+            }
+        }
+
+        best->score = score;
+        best->order = order;
+        return 1;
+    }
+
+    /**
+     * @brief Weighted score: 3 * cell candidates + values missing in its units (the default engine).
+     */
+    static inline uint32_t Sudoku_ScoreWeighted(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell)
+    {
+        (void)sel;
+        return 3u * cell->n_candidates + cell->n_row_empty + cell->n_col_empty + cell->n_sub_empty;
+    }
+
+    /**
+     * @brief Minimum remaining values: cell candidates only.
+     */
+    static inline uint32_t Sudoku_ScoreMRV(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell)
+    {
+        (void)sel;
+        return cell->n_candidates;
+    }
+
+    /**
+     * @brief Most constrained unit: cells of the unit with the fewest missing values, then fewest candidates.
+     */
+    static inline uint32_t Sudoku_ScoreUnit(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell)
+    {
+        uint32_t n_unit = cell->n_row_empty;
+
+        (void)sel;
+        n_unit = (cell->n_col_empty < n_unit) ? cell->n_col_empty : n_unit;
+        n_unit = (cell->n_sub_empty < n_unit) ? cell->n_sub_empty : n_unit;
+
+        return (n_unit << 4) + cell->n_candidates;
+    }
+
+    /**
+     * @brief Equal weights: cell candidates + values missing in its units.
+     */
+    static inline uint32_t Sudoku_ScoreEqualWeights(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell)
+    {
+        (void)sel;
+        return (uint32_t)cell->n_candidates + cell->n_row_empty + cell->n_col_empty + cell->n_sub_empty;
+    }
+
+    /**
+     * @brief Bivalue first: bivalue cells whose two values are scarcest, then the other cells by candidates.
+     */
+    static inline uint32_t Sudoku_ScoreBivalue(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell)
+    {
+        if (2 != cell->n_candidates)
+        {
+            return 1024u + cell->n_candidates;
+        }
+
+        uint32_t score = 0;
+        for (unsigned int value = 0; value < NUM_CANDIDATES; value++)
+        {
+            score += ((cell->candidates >> value) & 1u) ? sel->value_counts[value] : 0u;
+        }
+        return score;
+    }
+
+    /**
+     * @brief Least frequent value first: fewest candidates over the puzzle (the default engine).
+     */
+    static inline uint32_t Sudoku_OrderLeastFrequent(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value)
+    {
+        (void)cell;
+        return sel->value_counts[value];
+    }
+
+    /**
+     * @brief Most frequent value first: most candidates over the puzzle.
+     */
+    static inline uint32_t Sudoku_OrderMostFrequent(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value)
+    {
+        (void)cell;
+        return (uint32_t)(NUM_ROWS * NUM_COLS) - sel->value_counts[value];
+    }
+
+    /**
+     * @brief Lowest value first.
+     */
+    static inline uint32_t Sudoku_OrderAscending(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value)
+    {
+        (void)sel;
+        (void)cell;
+        return value;
+    }
+
+    /**
+     * @brief Least constraining value first: fewest cells of the row, column and subgrid losing the value.
+     */
+    static inline uint32_t Sudoku_OrderLeastConstraining(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value)
+    {
+        return (uint32_t)sel->unit_value_counts[cell->row][value] + sel->unit_value_counts[NUM_ROWS + cell->col][value] +
+               sel->unit_value_counts[NUM_ROWS + NUM_COLS + cell->sub][value];
+    }
+
+    /**
+     * @brief Built-in heuristics: "weighted", "mrv", "unit", "bivalue" and "mrv-lcv".
+     */
+    extern const Sudoku_Heuristic_T Sudoku_Heuristics[];
+
+    /**
+     * @brief Number of entries of @ref Sudoku_Heuristics.
+     */
+    extern const unsigned int Sudoku_NumHeuristics;
+
+    /**
+     * @brief Cell scorings of @ref Sudoku_BranchScore_T, indexed by its values.
+     */
+    extern const Sudoku_ScoreFunction_T Sudoku_BranchScores[];
+
+    /**
+     * @brief Value orderings of @ref Sudoku_ValueOrder_T, indexed by its values.
+     */
+    extern const Sudoku_OrderFunction_T Sudoku_ValueOrders[];
+
+    /**
+     * @brief Finds a built-in heuristic by name.
+     *
+     * @param name Name of the heuristic.
+     * @return const Sudoku_Heuristic_T* The heuristic, or NULL if there is none with that name.
+     */
+    const Sudoku_Heuristic_T *Sudoku_FindHeuristic(const char *name);
+
+    /**
+     * @brief Summarizes the open cells of a pruned puzzle.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @param[out] sel Selection to fill.
+     * @return SUDOKU_RC_SUCCESS, or SUDOKU_RC_NULL_POINTER.
+     */
+    Sudoku_RC_T Sudoku_PrepareSelection(SudokuPuzzle_P p, Sudoku_Selection_T *sel);
+
+    /**
+     * @brief Selects a candidate value for a cell using a heuristic.
+     *
+     * Same as Sudoku_SelectCandidateUsingConfig() with the heuristic in the configuration and no seed.
+     *
+     * @param[in] p Pointer to a Sudoku puzzle structure
+     * @param[in] heuristic Heuristic. NULL selects the first built-in heuristic.
+     * @param[out] row Pointer to a variable where the row index of the selected cell will be stored
+     * @param[out] col Pointer to a variable where the column index of the selected cell will be stored
+     * @return A selected candidate value if a suitable cell is found, otherwise SUDOKU_BIT_INVALID_VALUE
+     */
+    Sudoku_BitValues_T Sudoku_SelectCandidateUsingHeuristic(SudokuPuzzle_P p, const Sudoku_Heuristic_T *heuristic, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SUDOKU_HEURISTIC_H_INCLUDED
@@ -0,0 +1,124 @@
+/**
+ * @file sudoku_heuristic.hh
+ * @brief Branching heuristics as C++ policies
+ *
+ * A policy is any class with the two member functions
+ *
+ * @code
+ * uint32_t Score(const Sudoku_Selection_T &sel, const Sudoku_CellInfo_T &cell) const;
+ * uint32_t Order(const Sudoku_Selection_T &sel, const Sudoku_CellInfo_T &cell, unsigned int value) const;
+ * @endcode
+ *
+ * with the meaning of the function pointers of @ref Sudoku_Heuristic_T. SudokuPuzzle::SolveWith()
+ * instantiates the candidate selection for each policy, so the calls are resolved at compile time
+ * and inlined; the rest of the search is the one of SudokuPuzzle::Solve().
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_HEURISTIC_HH_INCLUDED
+#define SUDOKU_HEURISTIC_HH_INCLUDED
+
+#include "sudoku.hh"
+#include "sudoku_heuristic.h"
+
+/**
+ * @brief Policy made of a cell scoring and a value ordering function.
+ */
+template <uint32_t (*ScoreFunction)(const Sudoku_Selection_T *, const Sudoku_CellInfo_T *),
+          uint32_t (*OrderFunction)(const Sudoku_Selection_T *, const Sudoku_CellInfo_T *, unsigned int)>
+struct SudokuHeuristicPolicy
+{
+    uint32_t Score(const Sudoku_Selection_T &sel, const Sudoku_CellInfo_T &cell) const
+    {
+        return ScoreFunction(&sel, &cell);
+    }
+
+    uint32_t Order(const Sudoku_Selection_T &sel, const Sudoku_CellInfo_T &cell, unsigned int value) const
+    {
+        return OrderFunction(&sel, &cell, value);
+    }
+};
+
+/* Policies of the built-in heuristics, in the order of Sudoku_Heuristics */
+using SudokuWeightedPolicy = SudokuHeuristicPolicy<Sudoku_ScoreWeighted, Sudoku_OrderLeastFrequent>;
+using SudokuMRVPolicy = SudokuHeuristicPolicy<Sudoku_ScoreMRV, Sudoku_OrderAscending>;
+using SudokuUnitPolicy = SudokuHeuristicPolicy<Sudoku_ScoreUnit, Sudoku_OrderLeastFrequent>;
+using SudokuBivaluePolicy = SudokuHeuristicPolicy<Sudoku_ScoreBivalue, Sudoku_OrderLeastFrequent>;
+using SudokuLCVPolicy = SudokuHeuristicPolicy<Sudoku_ScoreMRV, Sudoku_OrderLeastConstraining>;
+
+/**
+ * @brief Policy calling the functions of a heuristic table.
+ */
+struct SudokuTablePolicy
+{
+    const Sudoku_Heuristic_T *heuristic;
+
+    uint32_t Score(const Sudoku_Selection_T &sel, const Sudoku_CellInfo_T &cell) const
+    {
+        return heuristic->score(&sel, &cell, heuristic->user);
+    }
+
+    uint32_t Order(const Sudoku_Selection_T &sel, const Sudoku_CellInfo_T &cell, unsigned int value) const
+    {
+        return heuristic->order(&sel, &cell, value, heuristic->user);
+    }
+};
+
+/**
+ * @brief Selects a candidate value for a cell using a policy.
+ *
+ * The loop of Sudoku_SelectCandidateUsingConfig() with the policy in place of the function pointers.
+ *
+ * @param rng_state Random tie-breaking state (not 0), nullptr keeps the first candidate.
+ * @return A selected candidate value if a suitable cell is found, otherwise SUDOKU_BIT_INVALID_VALUE
+ */
+template <class Policy>
+Sudoku_BitValues_T SudokuSelectCandidate(SudokuPuzzle_P p, const Policy &policy, Sudoku_Row_Index_T &row, Sudoku_Column_Index_T &col,
+                                         uint32_t *rng_state = nullptr)
+{
+    Sudoku_Selection_T sel;
+    Sudoku_SelectionBest_T best = {UINT32_MAX, UINT32_MAX, 0, rng_state};
+    Sudoku_BitValues_T best_candidate = SUDOKU_BIT_INVALID_VALUE;
+
+    (void)Sudoku_PrepareSelection(p, &sel);
+
+    for (unsigned int i = 0; i < sel.n_cells; i++)
+    {
+        const Sudoku_CellInfo_T &cell = sel.cells[i];
+        uint32_t score = policy.Score(sel, cell);
+
+        if (score > best.score)
+        {
+            continue;
+        }
+
+        for (unsigned int value = 0; value < NUM_CANDIDATES; value++)
+        {
+            if (0 == (cell.candidates & (1u << value)))
+            {
+                continue;
+            }
+
+            if (Sudoku_SelectionOffer(&best, score, policy.Order(sel, cell, value)))
+            {
+                best_candidate = (Sudoku_BitValues_T)(1 << value);
+                row = cell.row;
+                col = cell.col;
+            }
+        }
+    }
+
+    return best_candidate;
+}
+
+template <class Policy>
+Sudoku_RC_T SudokuPuzzle::SolveWith(const Policy &policy, const SudokuSolveOptions &options, SudokuSolveStats *stats)
+{
+    SudokuSelectFunction select = [](SudokuPuzzle_P p, const void *policy, uint32_t *rng_state, Sudoku_Row_Index_T &row, Sudoku_Column_Index_T &col)
+    { return SudokuSelectCandidate(p, *static_cast<const Policy *>(policy), row, col, rng_state); };
+
+    return Solve(options, stats, select, &policy);
+}
+
+#endif // SUDOKU_HEURISTIC_HH_INCLUDED
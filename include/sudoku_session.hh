@@ -0,0 +1,168 @@
+/**
+ * @file sudoku_session.hh
+ * @brief Interactive puzzle session with incremental candidates and cached solvability
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_SESSION_HH_INCLUDED
+#define SUDOKU_SESSION_HH_INCLUDED
+
+#include "sudoku.hh"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @class SudokuSession
+ * @brief A puzzle being played one digit at a time.
+ *
+ * Every edit updates per-unit digit counts, so candidates, conflicts and dead cells are known
+ * without recomputing any mask. Solvability and uniqueness are answered from the solutions and
+ * proofs found by earlier searches as long as the edits stay consistent with them; only when
+ * they do not is the puzzle searched again.
+ */
+class SudokuSession
+{
+public:
+    /**
+     * @brief Default constructor, creates a session on an empty grid.
+     */
+    SudokuSession(void);
+
+    /**
+     * @brief Constructor, creates a session on a puzzle in string notation.
+     * @param p The givens in string notation.
+     */
+    explicit SudokuSession(const std::string &p);
+
+    /**
+     * @brief Starts a new game. Cells with a value become givens and cannot be edited.
+     * @param p The givens in string notation.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, or SUDOKU_RC_INVALID_INPUT if the string is shorter than 81 characters.
+     */
+    Sudoku_RC_T Load(const std::string &p);
+
+    /**
+     * @brief Places a value, replacing the value of the cell if there is one.
+     *
+     * Values that conflict with other cells are accepted; they are reported by IsConflicting()
+     * and make the session invalid until erased.
+     *
+     * @param row The row index.
+     * @param col The column index.
+     * @param val The value to place (1 to 9).
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, SUDOKU_RC_INVALID_INPUT for a given or an index out of
+     *         range, or SUDOKU_RC_INVALID_VALUE.
+     */
+    Sudoku_RC_T Place(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, Sudoku_Values_T val);
+
+    /**
+     * @brief Erases the value of a cell.
+     * @param row The row index.
+     * @param col The column index.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, or SUDOKU_RC_INVALID_INPUT for a given or an index out of range.
+     */
+    Sudoku_RC_T Erase(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col);
+
+    /**
+     * @brief Gets the value of a cell.
+     * @return Sudoku_Values_T The value, SUDOKU_NO_VALUE for an empty cell, or SUDOKU_INVALID_VALUE.
+     */
+    Sudoku_Values_T GetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const;
+
+    /**
+     * @brief Gets the candidates of a cell: the values not yet placed in its row, column and subgrid.
+     * @return uint32_t Candidate mask, SUDOKU_MASK_NONE for a cell with a value.
+     */
+    uint32_t GetCandidates(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const;
+
+    /**
+     * @brief Checks whether a cell is a given of the loaded puzzle.
+     */
+    bool IsGiven(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const;
+
+    /**
+     * @brief Checks whether the value of a cell is repeated in its row, column or subgrid.
+     */
+    bool IsConflicting(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const;
+
+    /**
+     * @brief Checks that no value is repeated in a unit and that every empty cell has a candidate.
+     */
+    bool IsValid(void) const;
+
+    /**
+     * @brief Checks whether all cells have a value and the grid is valid.
+     */
+    bool IsComplete(void) const;
+
+    /**
+     * @brief Checks whether the current grid can still be completed.
+     *
+     * Searches only if no earlier solution or proof covers the current grid.
+     */
+    bool IsSolvable(void);
+
+    /**
+     * @brief Checks whether the current grid has exactly one completion.
+     *
+     * Searches only if no earlier solution or proof covers the current grid.
+     */
+    bool IsUnique(void);
+
+    /**
+     * @brief Gets the grid as a puzzle, with values only.
+     */
+    SudokuPuzzle GetPuzzle(void) const;
+
+    /**
+     * @brief Gets the grid as a string of 81 digits, 0 for empty cells.
+     */
+    std::string GetPuzzleAsString(void) const;
+
+    /**
+     * @brief Number of searches run by this session.
+     */
+    unsigned long Searches(void) const;
+
+private:
+    /**
+     * @brief A grid of values remembered from an earlier search.
+     *
+     * mismatches counts the cells that keep the current grid from being covered by the
+     * reference, and is updated on every edit.
+     */
+    struct Reference
+    {
+        uint8_t values[NUM_ROWS * NUM_COLS]; /**< Values of the reference grid, 0 for empty cells. */
+        unsigned int mismatches;             /**< Number of cells not covered. */
+        bool valid;                          /**< The reference holds a search result. */
+        bool complete;                       /**< Filled cells must match (solutions), otherwise reference cells must be filled and match (proofs). */
+    };
+
+    void Assign(unsigned int cell, uint8_t val);
+    void Remember(Reference &ref, const uint8_t *grid, bool complete);
+    bool Covers(const Reference &ref) const;
+    void Search(void);
+
+    static unsigned int Mismatch(const Reference &ref, unsigned int cell, uint8_t val);
+
+    uint8_t values[NUM_ROWS * NUM_COLS];           /**< Cell values, 0 for empty cells. */
+    bool given[NUM_ROWS * NUM_COLS];               /**< Cells of the loaded puzzle. */
+    uint8_t counts[3 * NUM_ROWS][NUM_CANDIDATES];  /**< Number of cells holding each value in each row, column and subgrid. */
+    uint32_t used[3 * NUM_ROWS];                   /**< Values present in each row, column and subgrid. */
+    bool dead[NUM_ROWS * NUM_COLS];                /**< Empty cells without candidates. */
+    unsigned int n_filled;                         /**< Number of cells with a value. */
+    unsigned int n_conflicts;                      /**< Number of repeated values over all units. */
+    unsigned int n_dead;                           /**< Number of empty cells without candidates. */
+
+    Reference solution;    /**< First solution found by the last search. */
+    Reference alternative; /**< Second solution found by the last search. */
+    Reference unique;      /**< Grid proven to have exactly one solution (the solution reference). */
+    Reference unsolvable;  /**< Grid proven to have no solution. */
+
+    unsigned long n_searches;
+};
+
+#endif // SUDOKU_SESSION_HH_INCLUDED
@@ -0,0 +1,151 @@
+/**
+ * @file sudoku_store.hh
+ * @brief Persistent memory-mapped solution store
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_STORE_HH_INCLUDED
+#define SUDOKU_STORE_HH_INCLUDED
+
+#include "sudoku.hh"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 81 cells packed as 4-bit values (0 for empty cells) in row-major order, low nibble first.
+ */
+typedef std::array<uint8_t, (NUM_ROWS * NUM_COLS + 1) / 2> SudokuPackedGrid;
+
+/**
+ * @brief Packs the values of a puzzle.
+ */
+void Sudoku_PackGrid(SudokuPuzzle &puzzle, SudokuPackedGrid &packed);
+
+/**
+ * @brief Writes packed values into a puzzle. Empty cells are left untouched.
+ * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_INVALID_VALUE for an out of range value.
+ */
+Sudoku_RC_T Sudoku_UnpackGrid(const SudokuPackedGrid &packed, SudokuPuzzle &puzzle);
+
+/**
+ * @brief Memory mapping of a store file.
+ */
+struct SudokuStoreMapping;
+
+/**
+ * @class SudokuSolutionStore
+ * @brief On-disk open-addressing hash table mapping puzzles to their solutions and solve statistics.
+ *
+ * The table is accessed through a shared memory mapping, so opening a store is O(1) and a warm
+ * restart serves previously solved puzzles without a load phase.
+ *
+ * Readers are lock-free: a slot is filled before its state is published, and filled slots are never
+ * modified in place. There is a single writer per file, enforced with an advisory file lock. The
+ * writer appends into free slots and, when the table gets too full or too many entries were erased,
+ * compacts it into a larger file that atomically replaces the old one. Mappings of replaced files are
+ * kept until the store is closed, and readers switch to the new file on their next lookup.
+ */
+class SudokuSolutionStore
+{
+public:
+    /**
+     * @brief Stored solution of a puzzle.
+     */
+    struct Record
+    {
+        SudokuPackedGrid solution; /**< Packed solution. */
+        SudokuSolveStats stats;    /**< Statistics of the solve that produced the solution, without the table counters. */
+    };
+
+    SudokuSolutionStore(void);
+    ~SudokuSolutionStore(void);
+
+    SudokuSolutionStore(const SudokuSolutionStore &) = delete;
+    SudokuSolutionStore &operator=(const SudokuSolutionStore &) = delete;
+
+    /**
+     * @brief Opens a store file, creating it if it does not exist and @p writable is set.
+     *
+     * @param path Path of the store file.
+     * @param writable Open as the single writer of the file.
+     * @param capacity Initial number of slots of a new file, rounded up to a power of two.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_INVALID_INPUT if the file is not a
+     *         store, SUDOKU_RC_ERROR on I/O errors or if another writer holds the file.
+     */
+    Sudoku_RC_T Open(const std::string &path, bool writable, size_t capacity = 1 << 16);
+
+    /**
+     * @brief Flushes and closes the store.
+     */
+    void Close(void);
+
+    /**
+     * @brief Looks up the solution of a packed puzzle. Lock-free and safe to call from any thread.
+     * @return true if the puzzle is stored.
+     */
+    bool Lookup(const SudokuPackedGrid &key, Record &record);
+
+    /**
+     * @brief Stores the solution of a packed puzzle. Existing entries are kept.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_ERROR if the store is read-only or I/O fails.
+     */
+    Sudoku_RC_T Insert(const SudokuPackedGrid &key, const Record &record);
+
+    /**
+     * @brief Removes the solution of a packed puzzle. The slot is reclaimed by the next compaction.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS if the puzzle was removed, SUDOKU_RC_ERROR otherwise.
+     */
+    Sudoku_RC_T Erase(const SudokuPackedGrid &key);
+
+    /**
+     * @brief Rewrites the table into a new file with at least @p capacity slots, dropping erased entries.
+     * @param capacity Minimum number of slots. 0 keeps the current capacity.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_ERROR if the store is read-only or I/O fails.
+     */
+    Sudoku_RC_T Compact(size_t capacity = 0);
+
+    /**
+     * @brief Writes the mapped table back to disk.
+     */
+    Sudoku_RC_T Flush(void);
+
+    /**
+     * @brief Solves a puzzle, answering from the store when it was solved before.
+     *
+     * On a miss the puzzle is solved and, if the store is writable, the solution is stored.
+     *
+     * @param puzzle The puzzle to solve.
+     * @param stats Optional statistics of the stored or new solve.
+     * @return Sudoku_RC_T The result code indicating success or failure.
+     */
+    Sudoku_RC_T Solve(SudokuPuzzle &puzzle, SudokuSolveStats *stats = nullptr);
+
+    size_t Size(void);
+    size_t Capacity(void);
+    unsigned long Hits(void) const;
+    unsigned long Misses(void) const;
+
+private:
+    SudokuStoreMapping *Current(void);
+    Sudoku_RC_T Remap(void);
+    Sudoku_RC_T Rebuild(size_t capacity);
+
+    std::string path;
+    bool writable;
+    int lock_fd;
+
+    std::atomic<SudokuStoreMapping *> mapping;
+    std::vector<SudokuStoreMapping *> retired; /**< Replaced mappings, unmapped on Close(). */
+    std::mutex remap_mutex;                    /**< Serializes writers and remapping after a compaction. */
+
+    std::atomic<unsigned long> hits;
+    std::atomic<unsigned long> misses;
+};
+
+#endif // SUDOKU_STORE_HH_INCLUDED
@@ -0,0 +1,91 @@
+/**
+ * @file sudoku_stream.hh
+ * @brief Streaming reader for plain or gzip-compressed text datasets
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_STREAM_HH_INCLUDED
+#define SUDOKU_STREAM_HH_INCLUDED
+
+#include "sudoku.hh"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class SudokuPuzzleStream
+ * @brief Reads a dataset (one 81-character puzzle per line) in a separate decompression stage.
+ *
+ * A reader thread decompresses the file with zlib (plain text files are read as is) and hands
+ * batches of puzzles to the solver workers through a bounded queue, so decompression overlaps
+ * with solving and memory use does not depend on the size of the dataset. Next() is thread-safe.
+ */
+class SudokuPuzzleStream
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param batch_size Number of puzzles per batch.
+     * @param max_batches Maximum number of decompressed batches waiting for a worker.
+     */
+    explicit SudokuPuzzleStream(size_t batch_size = 1024, size_t max_batches = 8);
+    ~SudokuPuzzleStream(void);
+
+    SudokuPuzzleStream(const SudokuPuzzleStream &) = delete;
+    SudokuPuzzleStream &operator=(const SudokuPuzzleStream &) = delete;
+
+    /**
+     * @brief Opens a dataset file and starts the reader thread.
+     * @param file_name Path of a plain or gzip-compressed dataset.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS on success, SUDOKU_RC_ERROR if the file cannot be opened.
+     */
+    Sudoku_RC_T Open(const std::string &file_name);
+
+    /**
+     * @brief Waits for the next batch of puzzles.
+     * @param batch Replaced by the next batch.
+     * @return true if a batch was returned, false at the end of the dataset.
+     */
+    bool Next(std::vector<std::string> &batch);
+
+    /**
+     * @brief Stops the reader thread and closes the file.
+     */
+    void Close(void);
+
+    /**
+     * @brief Result of the reader once the stream ended.
+     * @return Sudoku_RC_T SUDOKU_RC_SUCCESS, or SUDOKU_RC_ERROR if the file is corrupt or truncated.
+     */
+    Sudoku_RC_T Status(void) const;
+
+    /**
+     * @brief Number of puzzles read from the file so far.
+     */
+    unsigned long Count(void) const;
+
+private:
+    void Read(void *file);
+
+    const size_t batch_size;
+    const size_t max_batches;
+
+    std::thread reader;
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::deque<std::vector<std::string>> batches;
+    bool finished;
+    bool stopped;
+
+    std::atomic<Sudoku_RC_T> status;
+    std::atomic<unsigned long> count;
+};
+
+#endif // SUDOKU_STREAM_HH_INCLUDED
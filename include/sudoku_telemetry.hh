@@ -0,0 +1,132 @@
+/**
+ * @file sudoku_telemetry.hh
+ * @brief Per-puzzle solve telemetry, streamed as CSV or JSON Lines with summary histograms
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_TELEMETRY_HH_INCLUDED
+#define SUDOKU_TELEMETRY_HH_INCLUDED
+
+#include "sudoku.hh"
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+/**
+ * @brief Output format of the telemetry.
+ */
+enum class SudokuTelemetryFormat
+{
+    CSV,  /**< Header line, one line per puzzle and the histograms as '#' comment lines. */
+    JSONL /**< One object per puzzle, then one object per histogram. */
+};
+
+/**
+ * @brief Telemetry of the solve of one puzzle.
+ */
+struct SudokuTelemetryRecord
+{
+    unsigned long index;       /**< Index of the puzzle in the dataset. */
+    unsigned int clues;        /**< Number of givens. */
+    Sudoku_RC_T rc;            /**< Result of the solve. */
+    SudokuSolveStats stats;    /**< Nodes, backtracks, maximum depth and prune sweeps. */
+    uint64_t nanoseconds;      /**< Wall-clock time of the solve. */
+};
+
+/**
+ * @class SudokuTelemetry
+ * @brief Writes one line per solved puzzle and accumulates histograms of the solve statistics.
+ *
+ * Lines are written as the records arrive, so a dataset of any size is reported in constant
+ * memory. Histograms use power-of-two buckets: bucket 0 counts zeros and bucket k counts values
+ * from 2^(k-1) to 2^k - 1. Record() and Solve() may be called from several threads; lines are then
+ * written in completion order and carry the dataset index for sorting.
+ */
+class SudokuTelemetry
+{
+public:
+    /**
+     * @brief Statistic accumulated in a histogram.
+     */
+    enum Field
+    {
+        CLUES,
+        NODES,
+        BACKTRACKS,
+        MAX_DEPTH,
+        PRUNE_SWEEPS,
+        NANOSECONDS,
+        NUM_FIELDS
+    };
+
+    /** Number of power-of-two buckets of a histogram. */
+    static const unsigned int num_buckets = 65;
+
+    /**
+     * @brief Constructor. Writes the CSV header line.
+     * @param out Stream the lines are written to. Must outlive the telemetry.
+     * @param format Output format.
+     */
+    explicit SudokuTelemetry(std::ostream &out, SudokuTelemetryFormat format = SudokuTelemetryFormat::CSV);
+
+    SudokuTelemetry(const SudokuTelemetry &) = delete;
+    SudokuTelemetry &operator=(const SudokuTelemetry &) = delete;
+
+    /**
+     * @brief Solves a puzzle, timing it, and records its telemetry.
+     * @param puzzle The puzzle, solved in place.
+     * @param index Index of the puzzle in the dataset.
+     * @param options Budget of the solve.
+     * @return Sudoku_RC_T Result of the solve.
+     */
+    Sudoku_RC_T Solve(SudokuPuzzle &puzzle, unsigned long index, const SudokuSolveOptions &options = SudokuSolveOptions());
+
+    /**
+     * @brief Writes the line of a record and adds it to the histograms.
+     */
+    void Record(const SudokuTelemetryRecord &record);
+
+    /**
+     * @brief Writes the summary histograms. Records added afterwards start a new summary.
+     */
+    void Finish(void);
+
+    /**
+     * @brief Number of records since the last summary.
+     */
+    unsigned long Count(void) const;
+
+    /**
+     * @brief Number of records of a histogram bucket since the last summary.
+     */
+    unsigned long Bucket(Field field, unsigned int bucket) const;
+
+    /**
+     * @brief Sum of a statistic over the records since the last summary.
+     */
+    uint64_t Sum(Field field) const;
+
+    /**
+     * @brief Bucket of a value: 0 for 0, otherwise the bit length of the value.
+     */
+    static unsigned int BucketOf(uint64_t value);
+
+    /**
+     * @brief Name of a statistic as used in the column headers.
+     */
+    static const char *FieldName(Field field);
+
+private:
+    std::ostream &out;
+    const SudokuTelemetryFormat format;
+
+    mutable std::mutex mutex;
+    unsigned long count;
+    uint64_t sums[NUM_FIELDS];
+    uint64_t maxima[NUM_FIELDS];
+    unsigned long histograms[NUM_FIELDS][num_buckets];
+};
+
+#endif // SUDOKU_TELEMETRY_HH_INCLUDED
@@ -0,0 +1,111 @@
+/**
+ * @file sudoku_transposition.hh
+ * @brief Lock-free transposition table of search states
+ *
+ * Different branching orders often reach the same partial assignment. The table remembers the
+ * number of solutions of states that were searched completely, so a search reaching one of them
+ * again answers from the table instead of proving the result again. Dead states (no solution)
+ * are stored by SudokuPuzzle::Solve(), subtree counts by SudokuPuzzle::CountSolutions().
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#ifndef SUDOKU_TRANSPOSITION_HH_INCLUDED
+#define SUDOKU_TRANSPOSITION_HH_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @class SudokuTranspositionTable
+ * @brief Fixed-size, lock-free table of solution counts keyed by 64-bit state hashes.
+ *
+ * Each slot holds the count and the key combined with it by exclusive or, written and read
+ * with relaxed atomics. A slot torn by concurrent writers no longer matches any key, so
+ * readers discard it instead of taking a lock. New entries replace the previous entry of
+ * their slot. A table may be shared by any number of concurrent solves.
+ */
+class SudokuTranspositionTable
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param log2_entries Base 2 logarithm of the number of slots (16 bytes each).
+     */
+    explicit SudokuTranspositionTable(unsigned int log2_entries = 16);
+
+    /**
+     * @brief Looks up the solution count of a state.
+     *
+     * @param key Hash of the state. 0 never matches.
+     * @param count The stored count.
+     * @return true if the state is in the table.
+     */
+    bool Probe(uint64_t key, uint64_t &count) const
+    {
+        const Entry &entry = entries[key & mask];
+        const uint64_t data = entry.data.load(std::memory_order_relaxed);
+        const uint64_t check = entry.check.load(std::memory_order_relaxed);
+
+        if ((0 == key) || ((check ^ data) != key))
+        {
+            return false;
+        }
+
+        count = data;
+        return true;
+    }
+
+    /**
+     * @brief Stores the solution count of a completely searched state.
+     *
+     * @param key Hash of the state. 0 is not stored.
+     * @param count Number of solutions of the state, 0 for a dead state.
+     */
+    void Store(uint64_t key, uint64_t count)
+    {
+        Entry &entry = entries[key & mask];
+
+        if (0 != key)
+        {
+            entry.data.store(count, std::memory_order_relaxed);
+            entry.check.store(key ^ count, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Checks whether a state is known to have no solution.
+     */
+    bool IsDead(uint64_t key) const
+    {
+        uint64_t count = 1;
+        return Probe(key, count) && (0 == count);
+    }
+
+    /**
+     * @brief Removes all entries. Must not run concurrently with solves using the table.
+     */
+    void Clear(void);
+
+    /**
+     * @brief Number of slots.
+     */
+    size_t Capacity(void) const
+    {
+        return mask + 1;
+    }
+
+private:
+    struct Entry
+    {
+        std::atomic<uint64_t> check; /**< Key combined with the data by exclusive or. */
+        std::atomic<uint64_t> data;  /**< Solution count. */
+    };
+
+    std::unique_ptr<Entry[]> entries;
+    size_t mask;
+};
+
+#endif // SUDOKU_TRANSPOSITION_HH_INCLUDED
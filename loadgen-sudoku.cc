@@ -0,0 +1,349 @@
+/**
+ * @file loadgen-sudoku.cc
+ * @brief Load generator for sudoku-server
+ *
+ * Usage: sudoku-loadgen [--socket <path> | --tcp <port>] [--connections <n>] [--window <n>] [--repeat <n>] [--binary] <text file>
+ *
+ * Splits the puzzles of a dataset over several connections and sends them pipelined, with at most
+ * <window> requests in flight per connection (default 64, 0 for unlimited). Reports the throughput,
+ * the response status counts and the client-side latency percentiles.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "sudoku_dataset.h"
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+struct ConnectionResult
+{
+    vector<double> latencies_us;        /**< Client-side latency of each request. */
+    vector<double> server_latencies_us; /**< Latency reported by the server. */
+    map<string, unsigned long> status;
+};
+
+static int Connect(const string &socket_path, int tcp_port)
+{
+    int fd;
+
+    if (tcp_port > 0)
+    {
+        struct sockaddr_in addr = {};
+        int one = 1;
+
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons((uint16_t)tcp_port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (fd < 0 || 0 != connect(fd, (struct sockaddr *)&addr, sizeof(addr)))
+        {
+            return -1;
+        }
+        (void)setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    else
+    {
+        struct sockaddr_un addr = {};
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        addr.sun_family = AF_UNIX;
+        (void)strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+        if (fd < 0 || 0 != connect(fd, (struct sockaddr *)&addr, sizeof(addr)))
+        {
+            return -1;
+        }
+    }
+
+    return fd;
+}
+
+static bool SendAll(int fd, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t n = send(fd, data, size, MSG_NOSIGNAL);
+        if (n <= 0)
+        {
+            return false;
+        }
+        data += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * @brief Sends the requests of one connection from a separate thread and collects the responses.
+ *
+ * If the server closes the connection early, the sender is stopped instead of waiting for
+ * responses that never arrive.
+ */
+static void RunConnection(int fd, const vector<string> &requests, bool binary, size_t window, ConnectionResult &result)
+{
+    vector<Clock::time_point> sent(requests.size());
+    mutex window_mutex;
+    condition_variable window_open;
+    size_t n_sent = 0;
+    size_t received = 0;
+    bool stopped = false;
+
+    thread sender([&]()
+                  {
+        if (binary)
+        {
+            uint8_t header[SUDOKU_DATASET_HEADER_SIZE];
+            (void)Sudoku_Dataset_WriteHeader(header, 0, requests.size(), 0);
+            (void)SendAll(fd, reinterpret_cast<const char *>(header), sizeof(header));
+        }
+
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            {
+                /* Send times are shared with the receiver, so they are recorded under the window lock */
+                unique_lock<mutex> lock(window_mutex);
+                window_open.wait(lock, [&]
+                                 { return stopped || 0 == window || i - received < window; });
+                if (stopped)
+                {
+                    break;
+                }
+                sent[i] = Clock::now();
+                n_sent = i + 1;
+            }
+
+            if (!SendAll(fd, requests[i].data(), requests[i].size()))
+            {
+                break;
+            }
+        }
+        (void)shutdown(fd, SHUT_WR); });
+
+    string buffer;
+    char chunk[1 << 16];
+
+    while (received < requests.size())
+    {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0)
+        {
+            break;
+        }
+        auto now = Clock::now();
+        buffer.append(chunk, (size_t)n);
+
+        size_t pos = 0;
+        for (size_t eol; string::npos != (eol = buffer.find('\n', pos)); pos = eol + 1)
+        {
+            istringstream line(buffer.substr(pos, eol - pos));
+            unsigned long index = 0;
+            string status;
+            double server_latency = 0;
+
+            line >> index >> status >> server_latency;
+
+            lock_guard<mutex> lock(window_mutex);
+            /* A response to a request that was not sent has no send time */
+            if (index < n_sent)
+            {
+                result.latencies_us.push_back(chrono::duration<double, micro>(now - sent[index]).count());
+            }
+            result.server_latencies_us.push_back(server_latency);
+            result.status[status]++;
+            received++;
+        }
+        buffer.erase(0, pos);
+        window_open.notify_one();
+    }
+
+    if (received < requests.size())
+    {
+        {
+            lock_guard<mutex> lock(window_mutex);
+            stopped = true;
+        }
+        window_open.notify_one();
+
+        /* Unblock a sender stuck in send() */
+        (void)shutdown(fd, SHUT_RDWR);
+    }
+
+    sender.join();
+    (void)close(fd);
+}
+
+static double Percentile(vector<double> &values, double p)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+
+    size_t k = min(values.size() - 1, (size_t)(p / 100.0 * (double)values.size()));
+    nth_element(values.begin(), values.begin() + (ptrdiff_t)k, values.end());
+    return values[k];
+}
+
+int main(int argc, char *argv[])
+{
+    string socket_path = "/tmp/sudoku.sock";
+    int tcp_port = 0;
+    unsigned int n_connections = 4;
+    unsigned int repeat = 1;
+    size_t window = 64;
+    bool binary = false;
+    string file_name;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string option = argv[i];
+
+        if ("--binary" == option)
+        {
+            binary = true;
+        }
+        else if (i + 1 < argc && "--socket" == option)
+        {
+            socket_path = argv[++i];
+        }
+        else if (i + 1 < argc && "--tcp" == option)
+        {
+            tcp_port = stoi(argv[++i]);
+        }
+        else if (i + 1 < argc && "--connections" == option)
+        {
+            n_connections = max(1u, (unsigned int)stoul(argv[++i]));
+        }
+        else if (i + 1 < argc && "--window" == option)
+        {
+            window = stoul(argv[++i]);
+        }
+        else if (i + 1 < argc && "--repeat" == option)
+        {
+            repeat = max(1u, (unsigned int)stoul(argv[++i]));
+        }
+        else
+        {
+            file_name = option;
+        }
+    }
+
+    ifstream input(file_name);
+    if (file_name.empty() || !input)
+    {
+        cerr << "Usage: " << argv[0] << " [--socket <path> | --tcp <port>] [--connections <n>] [--window <n>] [--repeat <n>] [--binary] <text file>" << endl;
+        return 1;
+    }
+
+    /* Requests of each connection, already encoded */
+    vector<vector<string>> requests(n_connections);
+    Sudoku_Dataset_T dataset = {nullptr, 1, 0, (uint32_t)Sudoku_Dataset_RecordSize(0, 0), 0};
+    string line;
+    size_t total = 0;
+
+    vector<string> puzzles;
+    while (getline(input, line))
+    {
+        if (81 == line.length())
+        {
+            puzzles.push_back(line);
+        }
+    }
+
+    for (unsigned int r = 0; r < repeat; r++)
+    {
+        for (auto &puzzle : puzzles)
+        {
+            string request;
+
+            if (binary)
+            {
+                request.resize(dataset.record_size);
+                (void)Sudoku_Dataset_EncodeRecord(&dataset, reinterpret_cast<uint8_t *>(&request[0]), puzzle.c_str(), nullptr);
+            }
+            else
+            {
+                request = puzzle + "\n";
+            }
+
+            requests[total++ % n_connections].push_back(std::move(request));
+        }
+    }
+
+    vector<int> fds;
+    for (unsigned int c = 0; c < n_connections; c++)
+    {
+        int fd = Connect(socket_path, tcp_port);
+        if (fd < 0)
+        {
+            cerr << "Cannot connect to " << ((tcp_port > 0) ? "127.0.0.1:" + to_string(tcp_port) : socket_path) << endl;
+            return 1;
+        }
+        fds.push_back(fd);
+    }
+
+    vector<ConnectionResult> results(n_connections);
+    vector<thread> threads;
+    auto start = Clock::now();
+
+    for (unsigned int c = 0; c < n_connections; c++)
+    {
+        threads.emplace_back(RunConnection, fds[c], cref(requests[c]), binary, window, ref(results[c]));
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+    vector<double> latencies;
+    vector<double> server_latencies;
+    map<string, unsigned long> status;
+    for (auto &r : results)
+    {
+        latencies.insert(latencies.end(), r.latencies_us.begin(), r.latencies_us.end());
+        server_latencies.insert(server_latencies.end(), r.server_latencies_us.begin(), r.server_latencies_us.end());
+        for (auto &s : r.status)
+        {
+            status[s.first] += s.second;
+        }
+    }
+
+    cout << fixed << setprecision(1);
+    cout << latencies.size() << "/" << total << " responses in " << seconds << " s, "
+         << (double)latencies.size() / seconds << " puzzles/s over " << n_connections << " connections" << endl;
+    for (auto &s : status)
+    {
+        cout << "  " << s.first << ": " << s.second << endl;
+    }
+    cout << "Latency (us)  p50: " << Percentile(latencies, 50) << "  p90: " << Percentile(latencies, 90)
+         << "  p99: " << Percentile(latencies, 99) << "  p99.9: " << Percentile(latencies, 99.9)
+         << "  max: " << Percentile(latencies, 100) << endl;
+    cout << "Server (us)   p50: " << Percentile(server_latencies, 50) << "  p99: " << Percentile(server_latencies, 99) << endl;
+
+    return (latencies.size() == total) ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file report-sudoku.cc
+ * @brief Solves every puzzle of a dataset and writes its telemetry.
+ *
+ * Usage: sudoku-report [--jsonl] [--max-nodes <n>] [--output <file>] <text file>
+ *
+ *  --jsonl      Write JSON Lines instead of CSV.
+ *  --max-nodes  Node budget of each solve, 0 for unlimited (default).
+ *  --output     Write to a file instead of the standard output.
+ *
+ * The dataset may be plain or gzip-compressed text. Puzzles are solved in order, one line per
+ * puzzle, followed by the summary histograms.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "sudoku.hh"
+#include "sudoku_stream.hh"
+#include "sudoku_telemetry.hh"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    SudokuTelemetryFormat format = SudokuTelemetryFormat::CSV;
+    SudokuSolveOptions options;
+    string output_name;
+    string file_name;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "--jsonl"))
+        {
+            format = SudokuTelemetryFormat::JSONL;
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--max-nodes"))
+        {
+            options.max_nodes = stoul(argv[++i]);
+        }
+        else if (i + 1 < argc && 0 == strcmp(argv[i], "--output"))
+        {
+            output_name = argv[++i];
+        }
+        else
+        {
+            file_name = argv[i];
+        }
+    }
+
+    SudokuPuzzleStream stream;
+    if (file_name.empty() || SUDOKU_RC_SUCCESS != stream.Open(file_name))
+    {
+        cerr << "Usage: " << argv[0] << " [--jsonl] [--max-nodes <n>] [--output <file>] <text file>" << endl;
+        return 1;
+    }
+
+    ofstream output_file;
+    if (!output_name.empty())
+    {
+        output_file.open(output_name);
+        if (!output_file)
+        {
+            cerr << "Cannot write " << output_name << endl;
+            return 1;
+        }
+    }
+
+    SudokuTelemetry telemetry(output_name.empty() ? cout : output_file, format);
+    vector<string> batch;
+    unsigned long index = 0;
+
+    while (stream.Next(batch))
+    {
+        for (auto &line : batch)
+        {
+            SudokuPuzzle p(line);
+            (void)telemetry.Solve(p, index++, options);
+        }
+    }
+    telemetry.Finish();
+
+    if (SUDOKU_RC_SUCCESS != stream.Status())
+    {
+        cerr << "Corrupt or truncated dataset " << file_name << endl;
+        return 1;
+    }
+
+    return 0;
+}
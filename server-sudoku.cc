@@ -0,0 +1,569 @@
+/**
+ * @file server-sudoku.cc
+ * @brief Local solving daemon
+ *
+ * Usage: sudoku-server [--socket <path> | --tcp <port>] [--threads <n>] [--batch <n>] [--queue <n>] [--engine prune|dlx|backjump]
+ *
+ * Listens on a Unix domain socket (default /tmp/sudoku.sock) or on a loopback TCP port. A connection
+ * sends either newline-delimited puzzles in array notation, or a binary dataset header (see
+ * sudoku_dataset.h) followed by records; the record count of the header is ignored and records are
+ * read until the connection is closed.
+ *
+ * Requests of all connections are queued and taken in micro-batches by a pool of solver threads.
+ * The queue holds at most <queue> requests; readers wait while it is full. Every request gets one
+ * response line, in request order, written by a sender thread of the connection:
+ *
+ *     <index> <status> <latency in microseconds> <solution, or the puzzle if it was not solved>
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "sudoku.hh"
+#include "sudoku_dataset.h"
+
+using namespace std;
+
+static atomic<bool> running(true);
+
+static const char *StatusName(Sudoku_RC_T rc)
+{
+    switch (rc)
+    {
+    case SUDOKU_RC_SUCCESS:
+        return "SUCCESS";
+    case SUDOKU_RC_PRUNE:
+        return "PRUNE";
+    case SUDOKU_RC_CANCELLED:
+        return "CANCELLED";
+    case SUDOKU_RC_BUDGET_EXHAUSTED:
+        return "BUDGET_EXHAUSTED";
+    case SUDOKU_RC_NOT_SOLVABLE:
+        return "NOT_SOLVABLE";
+    case SUDOKU_RC_INVALID_VALUE:
+        return "INVALID_VALUE";
+    case SUDOKU_RC_INVALID_INPUT:
+        return "INVALID_INPUT";
+    case SUDOKU_RC_NULL_POINTER:
+        return "NULL_POINTER";
+    default:
+        return "ERROR";
+    }
+}
+
+/**
+ * @brief Client connection. Responses are written in request order by the sender thread of the connection.
+ */
+struct Connection
+{
+    explicit Connection(int fd) : fd(fd), next_index(0), n_requests(0), closed(false), broken(false), done(false) {}
+    ~Connection(void)
+    {
+        (void)close(fd);
+    }
+
+    /**
+     * @brief Queues the response of a request. Never blocks on the client.
+     */
+    void Respond(unsigned long index, string response)
+    {
+        {
+            lock_guard<mutex> lock(write_mutex);
+
+            if (broken)
+            {
+                return; /* The client went away */
+            }
+
+            pending[index] = std::move(response);
+
+            for (auto it = pending.begin(); it != pending.end() && it->first == next_index; it = pending.erase(it))
+            {
+                outbox += it->second;
+                next_index++;
+            }
+        }
+        writable.notify_one();
+    }
+
+    /**
+     * @brief Marks the end of the requests, after @p count requests.
+     */
+    void Close(unsigned long count)
+    {
+        {
+            lock_guard<mutex> lock(write_mutex);
+            n_requests = count;
+            closed = true;
+        }
+        writable.notify_one();
+    }
+
+    /**
+     * @brief Sends the queued responses until all requests are answered or the client goes away.
+     */
+    void Send(void)
+    {
+        unique_lock<mutex> lock(write_mutex);
+
+        while (running)
+        {
+            (void)writable.wait_for(lock, chrono::milliseconds(100), [this]
+                                    { return !outbox.empty() || (closed && n_requests == next_index); });
+
+            if (outbox.empty())
+            {
+                if (closed && n_requests == next_index)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            string out;
+            out.swap(outbox);
+            lock.unlock();
+
+            size_t written = 0;
+            while (written < out.size())
+            {
+                ssize_t n = send(fd, out.data() + written, out.size() - written, MSG_NOSIGNAL);
+                if (n <= 0)
+                {
+                    break;
+                }
+                written += (size_t)n;
+            }
+
+            lock.lock();
+            if (written < out.size())
+            {
+                broken = true;
+                outbox.clear();
+                pending.clear();
+                break;
+            }
+        }
+
+        done = true;
+    }
+
+    int fd;
+    mutex write_mutex;
+    condition_variable writable;
+    map<unsigned long, string> pending; /**< Responses waiting for earlier ones. */
+    string outbox;                      /**< Responses ready to be sent, in request order. */
+    unsigned long next_index;
+    unsigned long n_requests; /**< Number of requests, valid once closed. */
+    bool closed;              /**< Set once the client stopped sending requests. */
+    bool broken;              /**< Set once a send failed. */
+    atomic<bool> done;        /**< Set once the sender thread has finished. */
+};
+
+struct Request
+{
+    shared_ptr<Connection> connection;
+    unsigned long index;
+    Sudoku_RC_T rc; /**< SUDOKU_RC_SUCCESS if the puzzle was parsed. */
+    SudokuPuzzle puzzle;
+    chrono::steady_clock::time_point received;
+};
+
+/**
+ * @brief Queue of requests shared by all connections, consumed in micro-batches.
+ */
+class RequestQueue
+{
+public:
+    explicit RequestQueue(size_t capacity) : capacity(capacity) {}
+
+    /**
+     * @brief Queues a request, waiting while the queue is full.
+     * @return false if the server stopped before the request could be queued.
+     */
+    bool Push(Request &&request)
+    {
+        {
+            unique_lock<mutex> lock(queue_mutex);
+            while (requests.size() >= capacity)
+            {
+                if (!running)
+                {
+                    return false;
+                }
+                (void)not_full.wait_for(lock, chrono::milliseconds(100));
+            }
+            requests.push_back(std::move(request));
+        }
+        not_empty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Waits for requests and takes up to @p max_batch of them.
+     */
+    bool Pop(vector<Request> &batch, size_t max_batch)
+    {
+        unique_lock<mutex> lock(queue_mutex);
+        not_empty.wait_for(lock, chrono::milliseconds(100), [this]
+                           { return !requests.empty(); });
+
+        while (!requests.empty() && batch.size() < max_batch)
+        {
+            batch.push_back(std::move(requests.front()));
+            requests.pop_front();
+        }
+        lock.unlock();
+
+        if (!batch.empty())
+        {
+            not_full.notify_all();
+        }
+
+        return !batch.empty();
+    }
+
+private:
+    const size_t capacity;
+    mutex queue_mutex;
+    condition_variable not_empty;
+    condition_variable not_full;
+    deque<Request> requests;
+};
+
+static void Worker(RequestQueue &queue, size_t max_batch, Sudoku_Engine_T engine)
+{
+    vector<Request> batch;
+
+    while (running)
+    {
+        batch.clear();
+        if (!queue.Pop(batch, max_batch))
+        {
+            continue;
+        }
+
+        for (auto &request : batch)
+        {
+            auto rc = (SUDOKU_RC_SUCCESS == request.rc) ? request.puzzle.Solve(engine) : request.rc;
+            auto latency = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - request.received);
+
+            request.connection->Respond(request.index, to_string(request.index) + " " + StatusName(rc) + " " +
+                                                           to_string(latency.count()) + " " + request.puzzle.GetPuzzleAsString() + "\n");
+        }
+    }
+}
+
+/**
+ * @brief Reads the requests of a connection until it is closed.
+ */
+static void Reader(shared_ptr<Connection> connection, RequestQueue &queue)
+{
+    static const uint8_t dataset_magic[8] = {'S', 'U', 'D', 'O', 'K', 'U', 'D', 'S'};
+    string buffer;
+    char chunk[1 << 16];
+    unsigned long index = 0;
+    bool binary = false;
+    bool detected = false;
+    Sudoku_Dataset_T dataset = {};
+
+    for (;;)
+    {
+        ssize_t n = recv(connection->fd, chunk, sizeof(chunk), 0);
+        if (n <= 0)
+        {
+            connection->Close(index);
+            return;
+        }
+        buffer.append(chunk, (size_t)n);
+
+        if (!detected)
+        {
+            if (buffer.size() < sizeof(dataset_magic) && 0 == memcmp(buffer.data(), dataset_magic, buffer.size()))
+            {
+                continue; /* Could still be a binary header */
+            }
+
+            binary = (buffer.size() >= sizeof(dataset_magic)) && (0 == memcmp(buffer.data(), dataset_magic, sizeof(dataset_magic)));
+            if (binary)
+            {
+                if (buffer.size() < SUDOKU_DATASET_HEADER_SIZE)
+                {
+                    continue;
+                }
+
+                /* Records are streamed, so the header is validated as an empty dataset */
+                uint8_t header[SUDOKU_DATASET_HEADER_SIZE];
+                (void)memcpy(header, buffer.data(), sizeof(header));
+                (void)memset(&header[16], 0, 8);
+                if (SUDOKU_RC_SUCCESS != Sudoku_Dataset_Open(&dataset, header, sizeof(header)))
+                {
+                    connection->Respond(0, "0 INVALID_INPUT 0 \n");
+                    connection->Close(1);
+                    return;
+                }
+                buffer.erase(0, SUDOKU_DATASET_HEADER_SIZE);
+            }
+            detected = true;
+        }
+
+        auto now = chrono::steady_clock::now();
+        size_t pos = 0;
+
+        if (binary)
+        {
+            for (; buffer.size() - pos >= dataset.record_size; pos += dataset.record_size)
+            {
+                Sudoku_Dataset_T record = dataset;
+                record.records = reinterpret_cast<const uint8_t *>(buffer.data() + pos);
+                record.count = 1;
+
+                Request request{connection, index++, SUDOKU_RC_SUCCESS, SudokuPuzzle(), now};
+                request.rc = request.puzzle.InitializePuzzle(record, 0);
+                if (!queue.Push(std::move(request)))
+                {
+                    connection->Close(index - 1);
+                    return;
+                }
+            }
+        }
+        else
+        {
+            for (size_t eol; string::npos != (eol = buffer.find('\n', pos)); pos = eol + 1)
+            {
+                size_t length = eol - pos;
+                if (length > 0 && '\r' == buffer[eol - 1])
+                {
+                    length--;
+                }
+                if (0 == length)
+                {
+                    continue;
+                }
+
+                Request request{connection, index++, SUDOKU_RC_INVALID_INPUT, SudokuPuzzle(), now};
+                if ((NUM_ROWS * NUM_COLS) == length)
+                {
+                    request.rc = request.puzzle.InitializePuzzle(buffer.substr(pos, length));
+                }
+                if (!queue.Push(std::move(request)))
+                {
+                    connection->Close(index - 1);
+                    return;
+                }
+            }
+        }
+
+        buffer.erase(0, pos);
+    }
+}
+
+/**
+ * @brief Threads serving a connection.
+ */
+struct Client
+{
+    shared_ptr<Connection> connection;
+    thread reader;
+    thread sender;
+};
+
+static int Listen(const string &socket_path, int tcp_port)
+{
+    int fd;
+
+    if (tcp_port > 0)
+    {
+        struct sockaddr_in addr = {};
+        int one = 1;
+
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons((uint16_t)tcp_port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+        if (fd < 0 || 0 != ::bind(fd, (struct sockaddr *)&addr, sizeof(addr)))
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        struct sockaddr_un addr = {};
+
+        if (socket_path.size() >= sizeof(addr.sun_path))
+        {
+            return -1;
+        }
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        addr.sun_family = AF_UNIX;
+        (void)strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+        (void)unlink(socket_path.c_str());
+
+        if (fd < 0 || 0 != ::bind(fd, (struct sockaddr *)&addr, sizeof(addr)))
+        {
+            return -1;
+        }
+    }
+
+    return (0 == listen(fd, 64)) ? fd : -1;
+}
+
+int main(int argc, char *argv[])
+{
+    string socket_path = "/tmp/sudoku.sock";
+    int tcp_port = 0;
+    unsigned int n_threads = thread::hardware_concurrency();
+    size_t max_batch = 64;
+    size_t queue_capacity = 4096;
+    Sudoku_Engine_T engine = SUDOKU_ENGINE_PRUNE;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        string option = argv[i];
+        string value = argv[i + 1];
+
+        if ("--socket" == option)
+        {
+            socket_path = value;
+        }
+        else if ("--tcp" == option)
+        {
+            tcp_port = stoi(value);
+        }
+        else if ("--threads" == option)
+        {
+            n_threads = (unsigned int)stoul(value);
+        }
+        else if ("--batch" == option)
+        {
+            max_batch = stoul(value);
+        }
+        else if ("--queue" == option)
+        {
+            queue_capacity = stoul(value);
+        }
+        else if ("--engine" == option)
+        {
+            engine = ("dlx" == value) ? SUDOKU_ENGINE_DLX : (("backjump" == value) ? SUDOKU_ENGINE_BACKJUMP : SUDOKU_ENGINE_PRUNE);
+        }
+        else
+        {
+            cerr << "Usage: " << argv[0] << " [--socket <path> | --tcp <port>] [--threads <n>] [--batch <n>] [--queue <n>] [--engine prune|dlx|backjump]" << endl;
+            return 1;
+        }
+    }
+
+    n_threads = (n_threads > 0) ? n_threads : 1;
+    max_batch = (max_batch > 0) ? max_batch : 1;
+    queue_capacity = max(queue_capacity, max_batch);
+
+    int listen_fd = Listen(socket_path, tcp_port);
+    if (listen_fd < 0)
+    {
+        cerr << "Cannot listen on " << ((tcp_port > 0) ? "127.0.0.1:" + to_string(tcp_port) : socket_path) << endl;
+        return 1;
+    }
+
+    signal(SIGINT, [](int)
+           { running = false; });
+    signal(SIGTERM, [](int)
+           { running = false; });
+
+    RequestQueue queue(queue_capacity);
+    vector<thread> workers;
+    for (unsigned int i = 0; i < n_threads; i++)
+    {
+        workers.emplace_back(Worker, ref(queue), max_batch, engine);
+    }
+
+    cout << "Listening on " << ((tcp_port > 0) ? "127.0.0.1:" + to_string(tcp_port) : socket_path) << " with "
+         << n_threads << " workers" << endl;
+
+    list<Client> clients;
+
+    while (running)
+    {
+        /* Reap the threads of finished connections */
+        for (auto it = clients.begin(); it != clients.end();)
+        {
+            if (it->connection->done)
+            {
+                (void)shutdown(it->connection->fd, SHUT_RDWR);
+                it->reader.join();
+                it->sender.join();
+                it = clients.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        struct pollfd pfd = {listen_fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0)
+        {
+            continue;
+        }
+
+        int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        if (tcp_port > 0)
+        {
+            int one = 1;
+            (void)setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+
+        auto connection = make_shared<Connection>(fd);
+        clients.push_back(Client{connection, thread(Reader, connection, ref(queue)), thread(&Connection::Send, connection.get())});
+    }
+
+    for (auto &client : clients)
+    {
+        (void)shutdown(client.connection->fd, SHUT_RDWR);
+        client.reader.join();
+        client.sender.join();
+    }
+
+    for (auto &w : workers)
+    {
+        w.join();
+    }
+
+    (void)close(listen_fd);
+    if (tcp_port <= 0)
+    {
+        (void)unlink(socket_path.c_str());
+    }
+
+    return 0;
+}
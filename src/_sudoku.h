@@ -9,30 +9,15 @@ extern "C"
 #include "sudoku.h"
 
     /**
-     * @brief Represents a single cell in the Sudoku grid.
+     * @brief Mixes a 64-bit word into a well distributed 64-bit hash (SplitMix64).
      */
-    struct SudokuCell_S
+    static inline uint64_t Sudoku_Mix64(uint64_t z)
     {
-        uint32_t value;      /**< Value mask. */
-        uint32_t candidates; /**< Candidate mask. */
-    };
-
-    /**
-     * @brief Represents the Sudoku grid and its metadata.
-     */
-    struct SudokuPuzzle_S
-    {
-        struct SudokuCell_S grid[NUM_ROWS][NUM_COLS];                /**< A 9x9 grid of Sudoku cells. */
-        uint32_t row_candidates[NUM_ROWS];                           /**< Candidates for each row. */
-        uint32_t col_candidates[NUM_COLS];                           /**< Candidates for each column. */
-        uint32_t sub_candidates[NUM_SUBGRID_ROWS][NUM_SUBGRID_COLS]; /**< Candidates for each subgrid. */
-
-        unsigned int n_candidates[NUM_ROWS][NUM_COLS]; /**< Number of candidates for each cell in the grid. */
-        unsigned int val_n_candidates[NUM_CANDIDATES]; /**< Number of candidates for each possible value (1 to 9) in the puzzle. */
-        uint32_t n_row_candidates[NUM_ROWS];
-        uint32_t n_col_candidates[NUM_ROWS];
-        uint32_t n_sub_candidates[NUM_SUBGRID_ROWS][NUM_SUBGRID_COLS];
-    };
+        z += 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
 
 #ifdef __cplusplus
 }
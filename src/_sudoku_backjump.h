@@ -0,0 +1,72 @@
+#ifndef PRIV_SUDOKU_BACKJUMP_H_INCLUDED
+#define PRIV_SUDOKU_BACKJUMP_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "_sudoku.h"
+
+#define SUDOKU_BACKJUMP_LEVELS (NUM_ROWS * NUM_COLS + 1) /**< Root and one level per decision. */
+
+    /**
+     * @brief Set of decisions, bit d - 1 for the decision of level d.
+     *
+     * Bit 63 stands for all decisions of level 64 and deeper, so sets stay conservative there.
+     */
+    typedef uint64_t Sudoku_Decisions_T;
+
+    /**
+     * @brief Search state of one level, with the decisions each deduction depends on.
+     */
+    struct SudokuBackjumpState_S
+    {
+        struct SudokuPuzzle_S puzzle;                                     /**< Values, candidates and unit masks. */
+        Sudoku_Decisions_T value_reason[NUM_ROWS * NUM_COLS];             /**< Decisions a cell value depends on. */
+        Sudoku_Decisions_T elim_reason[NUM_ROWS * NUM_COLS][NUM_CANDIDATES]; /**< Decisions an eliminated candidate depends on. */
+    };
+
+    /**
+     * @brief Workspace of the conflict-directed backjumping engine.
+     *
+     * Fixed-size and free of pointers like the Dancing Links arena, but large (one state per
+     * level), so callers should allocate it once per thread and reuse it.
+     */
+    struct SudokuBackjump_S
+    {
+        struct SudokuBackjumpState_S states[SUDOKU_BACKJUMP_LEVELS];
+
+        Sudoku_SearchConfig_T config;   /**< Branching configuration. */
+        uint32_t rng_state;             /**< Random tie-breaking state. */
+        int jumping;                    /**< A conflict is being returned past uninvolved levels. */
+
+        unsigned long n_nodes_visited;  /**< Search nodes visited by the last search. */
+        unsigned int max_level;         /**< Maximum search depth reached by the last search. */
+        unsigned long n_backjumps;      /**< Conflicts that skipped at least one level. */
+        unsigned long n_levels_skipped; /**< Levels left without trying their remaining values. */
+    };
+
+    /**
+     * @brief Solves a puzzle with conflict-directed backjumping.
+     *
+     * Propagation eliminates the values of peers and places naked singles like Sudoku_PrunePuzzle(),
+     * and records for every placed value and eliminated candidate the set of decisions it depends on.
+     * A contradiction yields the union of the sets of the deductions involved. If the decision of a
+     * level is not in that set, trying its other values cannot help, so the search returns past it
+     * to the most recent decision involved. Otherwise the value is refuted at that level with the
+     * remaining decisions as reason, and the search continues there.
+     *
+     * @param bj Workspace.
+     * @param p Puzzle to solve. Overwritten with the solution on success.
+     * @param config Branching configuration, NULL for the default one.
+     * @return SUDOKU_RC_SUCCESS if solved, SUDOKU_RC_ERROR if the puzzle has no solution,
+     *         SUDOKU_RC_NULL_POINTER if a reference is NULL.
+     */
+    Sudoku_RC_T Sudoku_Backjump_Solve(struct SudokuBackjump_S *bj, SudokuPuzzle_P p, const Sudoku_SearchConfig_T *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PRIV_SUDOKU_BACKJUMP_H_INCLUDED
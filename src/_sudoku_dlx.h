@@ -0,0 +1,75 @@
+#ifndef PRIV_SUDOKU_DLX_H_INCLUDED
+#define PRIV_SUDOKU_DLX_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "sudoku.h"
+
+#define SUDOKU_DLX_COLUMNS (4 * NUM_ROWS * NUM_COLS)                /**< Cell, row-digit, column-digit and subgrid-digit constraints. */
+#define SUDOKU_DLX_ROWS (NUM_ROWS * NUM_COLS * NUM_CANDIDATES)      /**< One matrix row per (row, column, value) placement. */
+#define SUDOKU_DLX_NODES (1 + SUDOKU_DLX_COLUMNS + 4 * SUDOKU_DLX_ROWS) /**< Root, column headers and row nodes. */
+
+    typedef uint16_t Sudoku_DLX_Index_T;
+
+    /**
+     * @brief Dancing Links node arena for the 324-constraint exact cover matrix.
+     *
+     * The arena is fixed-size and holds no pointers, so it can live on the stack,
+     * in thread-local storage or in a pool and be reused across puzzles without
+     * any allocation. Index 0 is the root, indexes 1..324 are the column headers.
+     */
+    struct SudokuDLX_S
+    {
+        Sudoku_DLX_Index_T left[SUDOKU_DLX_NODES];
+        Sudoku_DLX_Index_T right[SUDOKU_DLX_NODES];
+        Sudoku_DLX_Index_T up[SUDOKU_DLX_NODES];
+        Sudoku_DLX_Index_T down[SUDOKU_DLX_NODES];
+        Sudoku_DLX_Index_T column[SUDOKU_DLX_NODES];
+        Sudoku_DLX_Index_T row[SUDOKU_DLX_NODES]; /**< Matrix row (placement) of each node. */
+        Sudoku_DLX_Index_T size[1 + SUDOKU_DLX_COLUMNS];
+
+        Sudoku_DLX_Index_T n_nodes;                        /**< Number of used nodes in the arena. */
+        Sudoku_DLX_Index_T n_partial;                      /**< Number of placements in the partial solution. */
+        Sudoku_DLX_Index_T partial[NUM_ROWS * NUM_COLS];   /**< Placements of the partial solution. */
+        Sudoku_DLX_Index_T solution[NUM_ROWS * NUM_COLS];  /**< Placements of the first solution found. */
+        Sudoku_DLX_Index_T second[NUM_ROWS * NUM_COLS];    /**< Placements of the second solution found, if any. */
+
+        unsigned long limit;       /**< Stop searching after this many solutions. */
+        unsigned long n_solutions; /**< Solutions found by the last search. */
+        unsigned long n_nodes_visited; /**< Search nodes visited by the last search. */
+        unsigned int max_level;    /**< Maximum search depth reached by the last search. */
+    };
+
+    /**
+     * @brief Solves or counts the solutions of a puzzle using Algorithm X with Dancing Links.
+     *
+     * Only the placements allowed by the cell values and candidate masks of the puzzle
+     * are added to the matrix. The puzzle itself is not modified; use
+     * Sudoku_DLX_StoreSolution() to write back the first solution.
+     *
+     * @param dlx Node arena.
+     * @param p Puzzle to solve.
+     * @param limit Maximum number of solutions to search for (at least 1).
+     * @return SUDOKU_RC_SUCCESS if at least one solution was found,
+     *         SUDOKU_RC_ERROR if the puzzle has no solution,
+     *         SUDOKU_RC_NULL_POINTER if a reference is NULL.
+     */
+    Sudoku_RC_T Sudoku_DLX_Solve(struct SudokuDLX_S *dlx, SudokuPuzzle_P p, unsigned long limit);
+
+    /**
+     * @brief Writes the first solution found by Sudoku_DLX_Solve() into a puzzle.
+     *
+     * @param dlx Node arena after a successful search.
+     * @param p Puzzle to write into.
+     * @return SUDOKU_RC_SUCCESS on success, SUDOKU_RC_ERROR if there is no solution to store.
+     */
+    Sudoku_RC_T Sudoku_DLX_StoreSolution(const struct SudokuDLX_S *dlx, SudokuPuzzle_P p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PRIV_SUDOKU_DLX_H_INCLUDED
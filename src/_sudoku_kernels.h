@@ -0,0 +1,79 @@
+#ifndef PRIV_SUDOKU_KERNELS_H_INCLUDED
+#define PRIV_SUDOKU_KERNELS_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "sudoku.h"
+
+#define SUDOKU_KERNEL_PORTABLE 0x00u /**< Lookup-table / bit-trick implementations only. */
+#define SUDOKU_KERNEL_POPCNT 0x01u   /**< Hardware population count. */
+#define SUDOKU_KERNEL_TZCNT 0x02u    /**< Hardware trailing zero count (BMI1). */
+
+    /**
+     * @brief Dispatch table for the candidate mask kernels.
+     *
+     * Every entry always points to a valid implementation. The table starts out with the
+     * portable implementations and is upgraded once at load time to the fastest
+     * implementations supported by the executing CPU.
+     */
+    struct SudokuKernels_S
+    {
+        unsigned int features;                 /**< SUDOKU_KERNEL_* flags of the selected implementations. */
+        unsigned int (*count)(uint32_t mask);  /**< Number of set bits in the mask. */
+        unsigned int (*lowest)(uint32_t mask); /**< Index of the lowest set bit. Mask must not be 0. */
+    };
+
+    /**
+     * @brief Active kernel dispatch table.
+     */
+    extern struct SudokuKernels_S Sudoku_Kernels;
+
+    /**
+     * @brief Selects the kernel implementations for the executing CPU.
+     *
+     * Runs automatically at load time on GCC and Clang. It is safe to call again,
+     * e.g. from toolchains without constructor support, before the first solve.
+     */
+    void Sudoku_SelectKernels(void);
+
+    /**
+     * @brief Resets the dispatch table to the portable implementations.
+     */
+    void Sudoku_SelectPortableKernels(void);
+
+    /**
+     * @brief Number of candidates in a mask.
+     */
+    static inline unsigned int Sudoku_KernelCount(uint32_t mask)
+    {
+        return Sudoku_Kernels.count(mask);
+    }
+
+    /**
+     * @brief Converts a candidate or value mask into a numeric value.
+     *
+     * @return SUDOKU_NO_VALUE for an empty mask, the value (1-9) for a single bit and
+     *         SUDOKU_NOT_EXCLUSIVE_VALUE if more than one bit is set.
+     */
+    static inline enum SudokuValues_E Sudoku_KernelMaskToValue(uint32_t mask)
+    {
+        if (0 == mask)
+        {
+            return SUDOKU_NO_VALUE;
+        }
+        else if (mask & (mask - 1))
+        {
+            return SUDOKU_NOT_EXCLUSIVE_VALUE;
+        }
+
+        return (enum SudokuValues_E)(Sudoku_Kernels.lowest(mask) + 1);
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PRIV_SUDOKU_KERNELS_H_INCLUDED
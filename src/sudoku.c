@@ -4,8 +4,11 @@ extern "C"
 #endif
 
 #include "_sudoku.h"
+#include "_sudoku_kernels.h"
+#include "sudoku_heuristic.h"
 
 #include <ctype.h>
+#include <string.h>
 
     /* Initialize Puzzle */
     Sudoku_RC_T Sudoku_InitializePuzzle(SudokuPuzzle_P p)
@@ -44,6 +47,28 @@ extern "C"
         return ret;
     }
 
+    /**
+     * @brief Zobrist key of a cell value. Empty and invalid values have no key.
+     */
+    static inline uint64_t zobristKey(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, uint32_t value)
+    {
+        if ((0 == value) || (value & ~SUDOKU_MASK_ALL) || (value & (value - 1)))
+        {
+            return 0;
+        }
+
+        return Sudoku_Mix64(((uint64_t)(row * NUM_COLS + col) << 16) | value);
+    }
+
+    /**
+     * @brief Sets the value of a cell, keeping the Zobrist hash of the puzzle up to date.
+     */
+    static inline void setCellValue(SudokuPuzzle_P p, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, uint32_t value)
+    {
+        p->hash ^= zobristKey(row, col, p->grid[row][col].value) ^ zobristKey(row, col, value);
+        p->grid[row][col].value = value;
+    }
+
     /* Set Value */
     Sudoku_RC_T Sudoku_SetValue(SudokuPuzzle_P p, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, int val)
     {
@@ -63,17 +88,17 @@ extern "C"
         if (val == 0)
         {
             p->grid[row][col].candidates = (uint32_t)SUDOKU_MASK_ALL; /* No candidate left */
-            p->grid[row][col].value = (uint32_t)SUDOKU_BIT_NO_VALUE;
+            setCellValue(p, row, col, (uint32_t)SUDOKU_BIT_NO_VALUE);
         }
         else if (val <= 9)
         {
             p->grid[row][col].candidates = (uint32_t)SUDOKU_MASK_NONE; /* No candidate left */
-            p->grid[row][col].value = 1 << ((unsigned int)val - 1);
+            setCellValue(p, row, col, 1u << ((unsigned int)val - 1));
         }
         else
         {
             p->grid[row][col].candidates = (uint32_t)SUDOKU_MASK_NONE;
-            p->grid[row][col].value = (uint32_t)SUDOKU_BIT_INVALID_VALUE;
+            setCellValue(p, row, col, (uint32_t)SUDOKU_BIT_INVALID_VALUE);
             return SUDOKU_RC_INVALID_VALUE;
         }
         return SUDOKU_RC_SUCCESS;
@@ -96,33 +121,14 @@ extern "C"
 
         /* This method does not check for the actual value, since it assumes that the Sudoku_BitValues_T enum is used */
         p->grid[row][col].candidates = (uint32_t)SUDOKU_MASK_NONE;
-        p->grid[row][col].value = (uint32_t)value;
+        setCellValue(p, row, col, (uint32_t)value);
 
         return SUDOKU_RC_SUCCESS;
     }
 
-    static enum SudokuValues_E convertMaskToValue(uint32_t val)
+    static inline enum SudokuValues_E convertMaskToValue(uint32_t val)
     {
-        if (val == 0)
-        {
-            return SUDOKU_NO_VALUE;
-        }
-
-        uint32_t bit_position = 0;
-        while (!(val & 1))
-        {
-            val >>= 1;
-            bit_position++;
-        }
-
-        if (val == 1) // Only one bit is set
-        {
-            return (enum SudokuValues_E)(bit_position + 1);
-        }
-        else // Multiple bits are set
-        {
-            return SUDOKU_NOT_EXCLUSIVE_VALUE;
-        }
+        return Sudoku_KernelMaskToValue(val);
     }
 
     /* Get Value */
@@ -145,6 +151,46 @@ extern "C"
         return (int)convertMaskToValue(p->grid[row][col].value);
     }
 
+    Sudoku_Values_T Sudoku_MaskToValue(uint32_t mask)
+    {
+        return convertMaskToValue(mask);
+    }
+
+    Sudoku_RC_T Sudoku_GetValues(const struct SudokuPuzzle_S *p, int8_t values[NUM_ROWS * NUM_COLS])
+    {
+        if ((NULL == p) || (NULL == values))
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+        {
+            values[i] = (int8_t)convertMaskToValue(p->grid[i / NUM_COLS][i % NUM_COLS].value);
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_RC_T Sudoku_GetCandidateMasks(const struct SudokuPuzzle_S *p, uint32_t masks[NUM_ROWS * NUM_COLS])
+    {
+        if ((NULL == p) || (NULL == masks))
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+        {
+            masks[i] = p->grid[i / NUM_COLS][i % NUM_COLS].candidates;
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    const struct SudokuCell_S *Sudoku_GetGrid(const struct SudokuPuzzle_S *p)
+    {
+        return (NULL == p) ? NULL : &p->grid[0][0];
+    }
+
     /* Probably not used? */
     int Sudoku_GetCandidates(SudokuPuzzle_P p, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col)
     {
@@ -326,6 +372,8 @@ extern "C"
     /**
      * @brief Generates a row mask for a given Sudoku puzzle and row index.
      *
+     * A repeated value in the row is added to the conflict counter of the puzzle.
+     *
      * @param p Pointer to a SudokuPuzzle_P object.
      * @param row Row index to generate the mask for.
      * @return 1 if the row mask changed, 0 otherwise.
@@ -333,14 +381,17 @@ extern "C"
     static int generateRowMask(SudokuPuzzle_P p, Sudoku_Row_Index_T row)
     {
         uint32_t mask = SUDOKU_BIT_NO_VALUE;
+        uint32_t repeated = SUDOKU_MASK_NONE;
         uint32_t old_mask = p->row_candidates[row];
 
         for (Sudoku_Column_Index_T col = 0; col < (Sudoku_Column_Index_T)NUM_COLS; ++col)
         {
+            repeated |= mask & p->grid[row][col].value;
             mask |= p->grid[row][col].value;
         }
 
         p->row_candidates[row] = (~mask & SUDOKU_MASK_ALL);
+        p->n_conflicts += (SUDOKU_MASK_NONE != repeated) ? 1 : 0;
 
         return old_mask != p->row_candidates[row];
     }
@@ -348,6 +399,8 @@ extern "C"
     /**
      * @brief Generates a column mask for a given Sudoku puzzle and column index.
      *
+     * A repeated value in the column is added to the conflict counter of the puzzle.
+     *
      * @param p Pointer to a SudokuPuzzle_P object.
      * @param col Column index to generate the mask for.
      * @return 1 if the column mask changed, 0 otherwise.
@@ -355,14 +408,17 @@ extern "C"
     static int generateColumnMask(SudokuPuzzle_P p, Sudoku_Column_Index_T col)
     {
         uint32_t mask = SUDOKU_BIT_NO_VALUE;
+        uint32_t repeated = SUDOKU_MASK_NONE;
         uint32_t old_mask = p->col_candidates[col];
 
         for (Sudoku_Row_Index_T row = 0; row < (Sudoku_Row_Index_T)NUM_ROWS; ++row)
         {
+            repeated |= mask & p->grid[row][col].value;
             mask |= p->grid[row][col].value;
         }
 
         p->col_candidates[col] = (~mask & SUDOKU_MASK_ALL);
+        p->n_conflicts += (SUDOKU_MASK_NONE != repeated) ? 1 : 0;
 
         return old_mask != p->col_candidates[col];
     }
@@ -370,6 +426,8 @@ extern "C"
     /**
      * @brief Generates a subgrid mask for a given Sudoku puzzle and subgrid indices.
      *
+     * A repeated value in the subgrid is added to the conflict counter of the puzzle.
+     *
      * @param p Pointer to a SudokuPuzzle_P object.
      * @param sub_row Subgrid row index to generate the mask for.
      * @param sub_col Subgrid column index to generate the mask for.
@@ -380,17 +438,20 @@ extern "C"
         Sudoku_Row_Index_T start_row = 3 * sub_row;
         Sudoku_Column_Index_T start_col = 3 * sub_col;
         uint32_t mask = SUDOKU_BIT_NO_VALUE;
+        uint32_t repeated = SUDOKU_MASK_NONE;
         uint32_t old_mask = p->sub_candidates[sub_row][sub_col];
 
         for (Sudoku_Row_Index_T row = 0; row < (Sudoku_Row_Index_T)NUM_SUBGRID_ROWS; ++row)
         {
             for (Sudoku_Column_Index_T col = 0; col < (Sudoku_Column_Index_T)NUM_SUBGRID_COLS; ++col)
             {
+                repeated |= mask & p->grid[start_row + row][start_col + col].value;
                 mask |= p->grid[start_row + row][start_col + col].value;
             }
         }
 
         p->sub_candidates[sub_row][sub_col] = (~mask & SUDOKU_MASK_ALL);
+        p->n_conflicts += (SUDOKU_MASK_NONE != repeated) ? 1 : 0;
 
         return old_mask != p->sub_candidates[sub_row][sub_col];
     }
@@ -531,14 +592,14 @@ extern "C"
         switch (cell_value)
         {
         case SUDOKU_INVALID_VALUE:
-            p->grid[row][col].value = SUDOKU_MASK_INVALID;
+            setCellValue(p, row, col, SUDOKU_MASK_INVALID);
             p->grid[row][col].candidates = SUDOKU_MASK_INVALID;
             change = SUDOKU_RC_ERROR;
             break;
         case SUDOKU_NO_VALUE:
             if (p->grid[row][col].value == SUDOKU_MASK_NONE)
             {
-                p->grid[row][col].value = SUDOKU_MASK_INVALID;
+                setCellValue(p, row, col, SUDOKU_MASK_INVALID);
                 p->grid[row][col].candidates = SUDOKU_MASK_INVALID;
                 change = SUDOKU_RC_ERROR;
             }
@@ -551,7 +612,7 @@ extern "C"
             change = SUDOKU_RC_SUCCESS;
             break;
         default:
-            p->grid[row][col].value = p->grid[row][col].candidates;
+            setCellValue(p, row, col, p->grid[row][col].candidates);
             p->grid[row][col].candidates = SUDOKU_MASK_NONE;
             change = SUDOKU_RC_PRUNE;
             break;
@@ -564,7 +625,8 @@ extern "C"
      * @brief Updates the candidates of all cells in a Sudoku puzzle.
      *
      * This function iterates through all cells in the puzzle and updates their candidates.
-     * It also counts the number of pruned candidates and returns the result.
+     * It also counts the number of pruned candidates and returns the result. On the way, the
+     * filled cells are counted and invalid values are added to the conflict counter.
      *
      * @param p Pointer to a SudokuPuzzle_P object.
      * @return Number of pruned candidates, or SUDOKU_RC_ERROR on failure.
@@ -574,6 +636,8 @@ extern "C"
         int change;
         int prune_counter = 0;
 
+        p->n_filled = 0;
+
         for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
         {
             for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
@@ -588,6 +652,10 @@ extern "C"
                 {
                     return SUDOKU_RC_ERROR; // Think about returning change (?)
                 }
+
+                uint32_t val = p->grid[row][col].value;
+                p->n_filled += (SUDOKU_BIT_NO_VALUE != val) ? 1 : 0;
+                p->n_conflicts += ((uint32_t)SUDOKU_BIT_INVALID_VALUE == val) ? 1 : 0;
             }
         }
 
@@ -634,15 +702,9 @@ extern "C"
      * @param mask Bitmask containing candidates.
      * @return The number of candidates in the mask.
      */
-    static int countCandidatesInMask(uint32_t mask)
+    static inline int countCandidatesInMask(uint32_t mask)
     {
-        int count = 0;
-        for (unsigned int i = 0; i < NUM_CANDIDATES; i++)
-        {
-            if (mask & (1 << i))
-                count++;
-        }
-        return count;
+        return (int)Sudoku_KernelCount(mask & SUDOKU_MASK_ALL);
     }
 
     /**
@@ -679,19 +741,15 @@ extern "C"
 
     static void countCandidateValues(SudokuPuzzle_P p)
     {
-        for (size_t val = 0; val < NUM_CANDIDATES; val++)
-        {
-            uint32_t val_mask = (1 << val);
-            p->val_n_candidates[val] = 0;
+        (void)memset(p->val_n_candidates, 0, sizeof(p->val_n_candidates));
 
-            for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
             {
-                for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+                for (uint32_t remaining = p->grid[row][col].candidates & SUDOKU_MASK_ALL; remaining != 0; remaining &= remaining - 1)
                 {
-                    if (val_mask & p->grid[row][col].candidates)
-                    {
-                        p->val_n_candidates[val]++;
-                    }
+                    p->val_n_candidates[Sudoku_Kernels.lowest(remaining)]++;
                 }
             }
         }
@@ -701,14 +759,7 @@ extern "C"
     {
         for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
         {
-            p->n_row_candidates[row] = 0;
-            for (size_t val = 0; val < NUM_CANDIDATES; val++)
-            {
-                if (p->row_candidates[row] & (1 << val))
-                {
-                    p->n_row_candidates[row]++;
-                }
-            }
+            p->n_row_candidates[row] = Sudoku_KernelCount(p->row_candidates[row]);
         }
     }
 
@@ -716,14 +767,7 @@ extern "C"
     {
         for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
         {
-            p->n_col_candidates[col] = 0;
-            for (size_t val = 0; val < NUM_CANDIDATES; val++)
-            {
-                if (p->col_candidates[col] & (1 << val))
-                {
-                    p->n_col_candidates[col]++;
-                }
-            }
+            p->n_col_candidates[col] = Sudoku_KernelCount(p->col_candidates[col]);
         }
     }
 
@@ -733,23 +777,16 @@ extern "C"
         {
             for (Sudoku_Column_Index_T col = 0; col < NUM_SUBGRID_COLS; col++)
             {
-                p->n_sub_candidates[row][col] = 0;
-                for (size_t val = 0; val < NUM_CANDIDATES; val++)
-                {
-                    if (p->sub_candidates[row][col] & (1 << val))
-                    {
-                        p->n_sub_candidates[row][col]++;
-                    }
-                }
+                p->n_sub_candidates[row][col] = Sudoku_KernelCount(p->sub_candidates[row][col]);
             }
         }
     }
 
-    Sudoku_BitValues_T Sudoku_SelectCandidate(SudokuPuzzle_P p, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col)
+    Sudoku_RC_T Sudoku_PrepareSelection(SudokuPuzzle_P p, Sudoku_Selection_T *sel)
     {
-        if (p == NULL || row == NULL || col == NULL)
+        if ((NULL == p) || (NULL == sel))
         {
-            return SUDOKU_BIT_INVALID_VALUE;
+            return SUDOKU_RC_NULL_POINTER;
         }
 
         countCandidatesInPuzzle(p);
@@ -758,38 +795,114 @@ extern "C"
         countCandidatesInCols(p);
         countCandidatesInSubgrids(p);
 
-        int min_score = INT32_MAX;
-        Sudoku_BitValues_T best_candidate = SUDOKU_BIT_INVALID_VALUE;
-        Sudoku_Row_Index_T best_row = 0;
-        Sudoku_Column_Index_T best_col = 0;
+        sel->n_cells = 0;
+        for (unsigned int value = 0; value < NUM_CANDIDATES; value++)
+        {
+            sel->value_counts[value] = (uint8_t)p->val_n_candidates[value];
+        }
+        (void)memset(sel->unit_value_counts, 0, sizeof(sel->unit_value_counts));
 
-        for (*row = 0; *row < NUM_ROWS; (*row)++)
+        for (unsigned int row = 0; row < NUM_ROWS; row++)
         {
-            for (*col = 0; *col < NUM_COLS; (*col)++)
+            for (unsigned int col = 0; col < NUM_COLS; col++)
             {
-                uint32_t cell_candidates = p->grid[*row][*col].candidates;
-                uint32_t score = 3 * p->n_candidates[*row][*col] + p->n_row_candidates[*row] + p->n_col_candidates[*col] + p->n_sub_candidates[*row / 3][*col / 3];
+                uint32_t candidates = p->grid[row][col].candidates & SUDOKU_MASK_ALL;
 
-                for (size_t i = 0; i < NUM_CANDIDATES; i++)
+                if (SUDOKU_MASK_NONE == candidates)
                 {
-                    uint32_t val = (1 << i);
-                    if (cell_candidates & val)
-                    {
-                        int n_val_cand = p->val_n_candidates[i];
-                        if (score < min_score || (score == min_score && n_val_cand < p->val_n_candidates[best_candidate]))
-                        {
-                            min_score = score;
-                            best_candidate = (Sudoku_BitValues_T)(val);
-                            best_row = *row;
-                            best_col = *col;
-                        }
-                    }
+                    continue;
+                }
+
+                Sudoku_CellInfo_T *cell = &sel->cells[sel->n_cells++];
+                unsigned int sub = 3 * (row / 3) + col / 3;
+
+                cell->row = (uint8_t)row;
+                cell->col = (uint8_t)col;
+                cell->sub = (uint8_t)sub;
+                cell->candidates = candidates;
+                cell->n_candidates = (uint8_t)p->n_candidates[row][col];
+                cell->n_row_empty = (uint8_t)p->n_row_candidates[row];
+                cell->n_col_empty = (uint8_t)p->n_col_candidates[col];
+                cell->n_sub_empty = (uint8_t)p->n_sub_candidates[row / 3][col / 3];
+
+                for (uint32_t remaining = candidates; remaining != 0; remaining &= remaining - 1)
+                {
+                    unsigned int value = Sudoku_Kernels.lowest(remaining);
+
+                    sel->unit_value_counts[row][value]++;
+                    sel->unit_value_counts[NUM_ROWS + col][value]++;
+                    sel->unit_value_counts[NUM_ROWS + NUM_COLS + sub][value]++;
                 }
             }
         }
 
-        *row = best_row;
-        *col = best_col;
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_BitValues_T Sudoku_SelectCandidate(SudokuPuzzle_P p, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col)
+    {
+        return Sudoku_SelectCandidateUsingConfig(p, NULL, NULL, row, col);
+    }
+
+    Sudoku_BitValues_T Sudoku_SelectCandidateUsingConfig(SudokuPuzzle_P p, const Sudoku_SearchConfig_T *config, uint32_t *rng_state, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col)
+    {
+        static const Sudoku_SearchConfig_T default_config = {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL};
+        Sudoku_ScoreFunction_T score_cell = Sudoku_BranchScores[SUDOKU_SCORE_WEIGHTED];
+        Sudoku_OrderFunction_T order_value = Sudoku_ValueOrders[SUDOKU_ORDER_LEAST_FREQUENT];
+        void *user = NULL;
+        Sudoku_Selection_T sel;
+
+        if (p == NULL || row == NULL || col == NULL)
+        {
+            return SUDOKU_BIT_INVALID_VALUE;
+        }
+
+        if (NULL == config)
+        {
+            config = &default_config;
+        }
+
+        if (NULL != config->heuristic)
+        {
+            score_cell = config->heuristic->score;
+            order_value = config->heuristic->order;
+            user = config->heuristic->user;
+        }
+        else
+        {
+            score_cell = ((unsigned int)config->score <= SUDOKU_SCORE_UNITS) ? Sudoku_BranchScores[config->score] : score_cell;
+            order_value = ((unsigned int)config->order <= SUDOKU_ORDER_ASCENDING) ? Sudoku_ValueOrders[config->order] : order_value;
+        }
+
+        Sudoku_SelectionBest_T best = {UINT32_MAX, UINT32_MAX, 0, NULL};
+        Sudoku_BitValues_T best_candidate = SUDOKU_BIT_INVALID_VALUE;
+
+        best.rng_state = ((0 != config->seed) && (NULL != rng_state) && (0 != *rng_state)) ? rng_state : NULL;
+
+        (void)Sudoku_PrepareSelection(p, &sel);
+
+        for (unsigned int i = 0; i < sel.n_cells; i++)
+        {
+            const Sudoku_CellInfo_T *cell = &sel.cells[i];
+            uint32_t score = score_cell(&sel, cell, user);
+
+            if (score > best.score)
+            {
+                continue;
+            }
+
+            for (uint32_t remaining = cell->candidates; remaining != 0; remaining &= remaining - 1)
+            {
+                unsigned int value = Sudoku_Kernels.lowest(remaining);
+
+                if (Sudoku_SelectionOffer(&best, score, order_value(&sel, cell, value, user)))
+                {
+                    best_candidate = (Sudoku_BitValues_T)(1 << value);
+                    *row = cell->row;
+                    *col = cell->col;
+                }
+            }
+        }
 
         return best_candidate;
     }
@@ -799,31 +912,202 @@ extern "C"
      *
      * This function repeatedly calls the functions to generate column masks, row masks, subgrid masks, and
      * puzzle cell masks, and updates the puzzle's candidates until no more changes are detected.
-     * After pruning, the function checks if the Sudoku puzzle is solved or if an error has occurred.
+     * The last pass visits every unit and cell without changing them, so the repeated values and filled
+     * cells it counts give the status of the puzzle without another scan of the grid.
      *
      * @param[in] p Pointer to a Sudoku puzzle structure
-     * @return A Sudoku return code indicating the status of the puzzle after pruning (SUDOKU_RC_SUCCESS, SUDOKU_RC_SOLVED, or SUDOKU_RC_ERROR)
+     * @return A Sudoku return code indicating the status of the puzzle after pruning (SUDOKU_RC_SUCCESS, SUDOKU_RC_PRUNE, or SUDOKU_RC_ERROR)
      */
     Sudoku_RC_T Sudoku_PrunePuzzle(SudokuPuzzle_P p)
     {
-
         int changes = 0;
         if (NULL == p)
         {
             return SUDOKU_RC_NULL_POINTER;
         }
 
+        p->n_sweeps = 0;
+
         do
         {
+            p->n_sweeps++;
+            p->n_conflicts = 0;
+
             changes = 0;
             changes += generateColumnMasks(p);
             changes += generateRowMasks(p);
             changes += generateSubgridMasks(p);
             changes += generatePuzzleCellMasks(p);
-            changes += updatePuzzleCandidates(p);
+
+            int prunes = updatePuzzleCandidates(p);
+            if (prunes < 0)
+            {
+                p->n_conflicts++;
+                return SUDOKU_RC_ERROR;
+            }
+            changes += prunes;
         } while (changes > 0);
 
-        return Sudoku_Check(p);
+        return Sudoku_GetStatus(p);
+    }
+
+    Sudoku_RC_T Sudoku_GetStatus(const struct SudokuPuzzle_S *p)
+    {
+        if (NULL == p)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+        else if (0 != p->n_conflicts)
+        {
+            return SUDOKU_RC_ERROR;
+        }
+
+        return (NUM_ROWS * NUM_COLS == p->n_filled) ? SUDOKU_RC_SUCCESS : SUDOKU_RC_PRUNE;
+    }
+
+    uint64_t Sudoku_GetHash(const struct SudokuPuzzle_S *p)
+    {
+        return (NULL == p) ? 0 : p->hash;
+    }
+
+    /**
+     * @brief Counts a search node and propagates at the level and probe budget of the options, unless the budget is spent.
+     */
+    static Sudoku_RC_T enterSolveNode(SudokuPuzzle_P p, const Sudoku_SolveOptions_T *options, unsigned int level, Sudoku_Stats_T *stats)
+    {
+        if ((NULL != options->cancel) && (0 != options->cancel(options->user)))
+        {
+            return SUDOKU_RC_CANCELLED;
+        }
+        else if ((0 != options->max_nodes) && (stats->solve_calls >= options->max_nodes))
+        {
+            return SUDOKU_RC_BUDGET_EXHAUSTED;
+        }
+
+        stats->max_level = (level > stats->max_level) ? level : stats->max_level;
+        stats->solve_calls++;
+
+        Sudoku_RC_T rc = Sudoku_ProbePuzzle(p, options->propagation, options->probe_budget, &stats->propagation);
+        stats->prune_sweeps += p->n_sweeps;
+
+        return rc;
+    }
+
+    /**
+     * @brief Restores the values and candidates saved in a frame. Unit masks are rebuilt by the next pruning.
+     */
+    static void restoreSolveFrame(SudokuPuzzle_P p, const Sudoku_SolveFrame_T *frame)
+    {
+        (void)memcpy(p->grid, frame->grid, sizeof(p->grid));
+        p->hash = frame->hash;
+    }
+
+    Sudoku_RC_T Sudoku_SolveBegin(Sudoku_SolveTask_T *task, SudokuPuzzle_P p, Sudoku_Workspace_T *ws, const Sudoku_SolveOptions_T *options)
+    {
+        static const Sudoku_SolveOptions_T default_options = {{SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL}, 0, NULL, NULL, SUDOKU_PROPAGATE_SINGLES, 0};
+
+        if ((NULL == task) || (NULL == p) || (NULL == ws))
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        (void)memset(task, 0, sizeof(*task));
+        task->puzzle = p;
+        task->ws = ws;
+        task->options = (NULL != options) ? *options : default_options;
+        task->rng_state = task->options.config.seed;
+        task->rc = enterSolveNode(p, &task->options, 0, &task->stats);
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_RC_T Sudoku_SolveStep(Sudoku_SolveTask_T *task)
+    {
+        if (NULL == task)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        SudokuPuzzle_P p = task->puzzle;
+
+        if (SUDOKU_RC_PRUNE == task->rc)
+        {
+            Sudoku_Row_Index_T row = 0;
+            Sudoku_Column_Index_T col = 0;
+            Sudoku_BitValues_T cand = Sudoku_SelectCandidateUsingConfig(p, &task->options.config, &task->rng_state, &row, &col);
+            Sudoku_SolveFrame_T *frame = &task->ws->frames[task->level];
+
+            if ((SUDOKU_BIT_INVALID_VALUE == cand) || (task->level >= NUM_ROWS * NUM_COLS))
+            {
+                task->rc = SUDOKU_RC_ERROR;
+                return SUDOKU_RC_PRUNE;
+            }
+
+            (void)memcpy(frame->grid, p->grid, sizeof(frame->grid));
+            frame->hash = p->hash;
+            frame->row = (uint8_t)row;
+            frame->col = (uint8_t)col;
+            frame->candidate = (uint32_t)cand;
+
+            (void)Sudoku_SetValueUsingBitmask(p, row, col, cand);
+            task->rc = enterSolveNode(p, &task->options, ++task->level, &task->stats);
+        }
+        else if ((SUDOKU_RC_SUCCESS == task->rc) || (0 == task->level))
+        {
+            return task->rc;
+        }
+        else if (SUDOKU_RC_ERROR == task->rc)
+        {
+            /* Undo the branch and refute its value on the level above */
+            const Sudoku_SolveFrame_T *frame = &task->ws->frames[--task->level];
+
+            task->stats.backtracks++;
+            restoreSolveFrame(p, frame);
+            (void)removeCandidate(p, frame->row, frame->col, frame->candidate);
+            task->rc = Sudoku_ProbePuzzle(p, task->options.propagation, task->options.probe_budget, &task->stats.propagation);
+            task->stats.prune_sweeps += p->n_sweeps;
+        }
+        else
+        {
+            /* Budget spent or cancelled: leave the root state */
+            restoreSolveFrame(p, &task->ws->frames[0]);
+            (void)Sudoku_PrunePuzzle(p);
+            task->level = 0;
+            return task->rc;
+        }
+
+        return SUDOKU_RC_PRUNE;
+    }
+
+    Sudoku_RC_T Sudoku_Solve(SudokuPuzzle_P p, Sudoku_Workspace_T *ws, const Sudoku_SolveOptions_T *options, Sudoku_Stats_T *stats)
+    {
+        Sudoku_SolveTask_T task;
+        Sudoku_RC_T rc = Sudoku_SolveBegin(&task, p, ws, options);
+
+        if (SUDOKU_RC_SUCCESS != rc)
+        {
+            return rc;
+        }
+
+        while (SUDOKU_RC_PRUNE == (rc = Sudoku_SolveStep(&task)))
+        {
+        }
+
+        if (NULL != stats)
+        {
+            *stats = task.stats;
+        }
+
+        return rc;
+    }
+
+    void Sudoku_AccumulateStats(Sudoku_Stats_T *total, const Sudoku_Stats_T *stats)
+    {
+        total->max_level = (stats->max_level > total->max_level) ? stats->max_level : total->max_level;
+        total->solve_calls += stats->solve_calls;
+        total->backtracks += stats->backtracks;
+        total->prune_sweeps += stats->prune_sweeps;
+        Sudoku_AccumulatePropagationStats(&total->propagation, &stats->propagation);
     }
 
     Sudoku_RC_T Sudoku_InitializeFromArray(SudokuPuzzle_P p, const char *sudoku_array)
@@ -855,6 +1139,507 @@ extern "C"
         return rc;
     }
 
+    /**
+     * @brief Row and column of the k-th cell of a unit (rows 0-8, columns 9-17, subgrids 18-26).
+     */
+    static inline void unitCell(unsigned int unit, unsigned int k, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col)
+    {
+        if (unit < NUM_ROWS)
+        {
+            *row = unit;
+            *col = k;
+        }
+        else if (unit < NUM_ROWS + NUM_COLS)
+        {
+            *row = k;
+            *col = unit - NUM_ROWS;
+        }
+        else
+        {
+            unsigned int sub = unit - NUM_ROWS - NUM_COLS;
+            *row = 3 * (sub / 3) + k / 3;
+            *col = 3 * (sub % 3) + k % 3;
+        }
+    }
+
+    /**
+     * @brief Resets a hint to a technique found in a unit, without cells or eliminations.
+     */
+    static void hintStart(Sudoku_Hint_T *hint, Sudoku_HintTechnique_T technique, unsigned int unit, uint32_t values)
+    {
+        hint->technique = technique;
+        hint->unit = (uint8_t)unit;
+        hint->n_cells = 0;
+        hint->values = values;
+        hint->n_eliminations = 0;
+    }
+
+    static void hintAddCell(Sudoku_Hint_T *hint, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col)
+    {
+        hint->cells[hint->n_cells++] = (uint8_t)(row * NUM_COLS + col);
+    }
+
+    static void hintEliminate(Sudoku_Hint_T *hint, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, uint32_t candidates)
+    {
+        if (SUDOKU_MASK_NONE != candidates)
+        {
+            hint->elim_cells[hint->n_eliminations] = (uint8_t)(row * NUM_COLS + col);
+            hint->elim_candidates[hint->n_eliminations++] = candidates;
+        }
+    }
+
+    /**
+     * @brief Reports a repeated value, a cell without candidates or a value without a place in a unit.
+     */
+    static Sudoku_RC_T hintContradiction(Sudoku_Hint_T *hint, unsigned int unit, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, uint32_t values)
+    {
+        hintStart(hint, SUDOKU_HINT_CONTRADICTION, unit, values);
+        hintAddCell(hint, row, col);
+        return SUDOKU_RC_NOT_SOLVABLE;
+    }
+
+    /**
+     * @brief Finds a repeated value or an invalid cell value.
+     */
+    static Sudoku_RC_T hintFindRepeatedValue(SudokuPuzzle_P p, Sudoku_Hint_T *hint)
+    {
+        for (unsigned int unit = 0; unit < 3 * NUM_SUBGRID; unit++)
+        {
+            uint32_t unit_values = SUDOKU_MASK_NONE;
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                Sudoku_Row_Index_T row;
+                Sudoku_Column_Index_T col;
+                unitCell(unit, k, &row, &col);
+
+                uint32_t value = p->grid[row][col].value;
+                if ((value & ~SUDOKU_MASK_ALL) || (value & (value - 1)) || (unit_values & value))
+                {
+                    return hintContradiction(hint, unit, row, col, value & SUDOKU_MASK_ALL);
+                }
+                unit_values |= value;
+            }
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    /**
+     * @brief Full houses, naked singles and hidden singles.
+     *
+     * Subgrids are searched before rows and columns, as they are the easiest units to spot.
+     */
+    static int hintFindSingle(SudokuPuzzle_P w, Sudoku_Hint_T *hint, Sudoku_RC_T *rc)
+    {
+        for (unsigned int i = 0; i < 3 * NUM_SUBGRID; i++)
+        {
+            unsigned int unit = (i + 2 * NUM_SUBGRID) % (3 * NUM_SUBGRID);
+            unsigned int n_empty = 0;
+            Sudoku_Row_Index_T row, empty_row = 0;
+            Sudoku_Column_Index_T col, empty_col = 0;
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                unitCell(unit, k, &row, &col);
+                if (SUDOKU_MASK_NONE == w->grid[row][col].value)
+                {
+                    n_empty++;
+                    empty_row = row;
+                    empty_col = col;
+                }
+            }
+
+            if (1 == n_empty)
+            {
+                hintStart(hint, SUDOKU_HINT_FULL_HOUSE, unit, w->grid[empty_row][empty_col].candidates);
+                hintAddCell(hint, empty_row, empty_col);
+                return 1;
+            }
+        }
+
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                if (1 == countCandidatesInCell(w, row, col))
+                {
+                    hintStart(hint, SUDOKU_HINT_NAKED_SINGLE, row, w->grid[row][col].candidates);
+                    hintAddCell(hint, row, col);
+                    return 1;
+                }
+            }
+        }
+
+        for (unsigned int i = 0; i < 3 * NUM_SUBGRID; i++)
+        {
+            unsigned int unit = (i + 2 * NUM_SUBGRID) % (3 * NUM_SUBGRID);
+            uint32_t once = SUDOKU_MASK_NONE;
+            uint32_t twice = SUDOKU_MASK_NONE;
+            uint32_t placed = SUDOKU_MASK_NONE;
+            Sudoku_Row_Index_T row;
+            Sudoku_Column_Index_T col;
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                unitCell(unit, k, &row, &col);
+                twice |= once & w->grid[row][col].candidates;
+                once |= w->grid[row][col].candidates;
+                placed |= w->grid[row][col].value;
+            }
+
+            uint32_t missing = SUDOKU_MASK_ALL & ~(once | placed);
+            if (SUDOKU_MASK_NONE != missing)
+            {
+                unitCell(unit, 0, &row, &col);
+                *rc = hintContradiction(hint, unit, row, col, missing);
+                return 1;
+            }
+
+            uint32_t hidden = once & ~twice;
+            if (SUDOKU_MASK_NONE == hidden)
+            {
+                continue;
+            }
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                unitCell(unit, k, &row, &col);
+                uint32_t single = w->grid[row][col].candidates & hidden;
+
+                if (SUDOKU_MASK_NONE != single)
+                {
+                    hintStart(hint, SUDOKU_HINT_HIDDEN_SINGLE, unit, single & (~single + 1));
+                    hintAddCell(hint, row, col);
+                    return 1;
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Candidates of the three cells where a row (or column) crosses a subgrid.
+     */
+    static uint32_t segmentCandidates(SudokuPuzzle_P w, int is_row, unsigned int line, unsigned int segment)
+    {
+        uint32_t mask = SUDOKU_MASK_NONE;
+
+        for (unsigned int k = 3 * segment; k < 3 * segment + 3; k++)
+        {
+            mask |= is_row ? w->grid[line][k].candidates : w->grid[k][line].candidates;
+        }
+
+        return mask;
+    }
+
+    /**
+     * @brief Fills a locked candidates hint: the base cells of a segment, and the eliminations
+     *        along the line (pointing) or in the rest of the subgrid (claiming).
+     */
+    static int hintLocked(SudokuPuzzle_P w, Sudoku_Hint_T *hint, Sudoku_HintTechnique_T technique, int is_row, unsigned int line, unsigned int segment, uint32_t value)
+    {
+        unsigned int sub = is_row ? 3 * (line / 3) + segment : 3 * segment + line / 3;
+        unsigned int unit = (SUDOKU_HINT_POINTING == technique) ? 2 * NUM_SUBGRID + sub : (is_row ? line : NUM_ROWS + line);
+
+        hintStart(hint, technique, unit, value);
+
+        for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+        {
+            Sudoku_Row_Index_T row = is_row ? line : k;
+            Sudoku_Column_Index_T col = is_row ? k : line;
+
+            if ((k / 3) == segment)
+            {
+                if (w->grid[row][col].candidates & value)
+                {
+                    hintAddCell(hint, row, col);
+                }
+            }
+            else if (SUDOKU_HINT_POINTING == technique)
+            {
+                hintEliminate(hint, row, col, w->grid[row][col].candidates & value);
+            }
+        }
+
+        if (SUDOKU_HINT_CLAIMING == technique)
+        {
+            for (unsigned int other = 3 * (line / 3); other < 3 * (line / 3) + 3; other++)
+            {
+                for (unsigned int k = 3 * segment; (other != line) && (k < 3 * segment + 3); k++)
+                {
+                    Sudoku_Row_Index_T row = is_row ? other : k;
+                    Sudoku_Column_Index_T col = is_row ? k : other;
+                    hintEliminate(hint, row, col, w->grid[row][col].candidates & value);
+                }
+            }
+        }
+
+        return hint->n_eliminations > 0;
+    }
+
+    /**
+     * @brief Locked candidates: pointing (subgrid to line) first, then claiming (line to subgrid).
+     */
+    static int hintFindLockedCandidates(SudokuPuzzle_P w, Sudoku_Hint_T *hint)
+    {
+        for (int claiming = 0; claiming < 2; claiming++)
+        {
+            for (int is_row = 1; is_row >= 0; is_row--)
+            {
+                for (unsigned int line = 0; line < NUM_ROWS; line++)
+                {
+                    for (unsigned int segment = 0; segment < 3; segment++)
+                    {
+                        uint32_t mask = segmentCandidates(w, is_row, line, segment);
+                        uint32_t others = SUDOKU_MASK_NONE;
+
+                        if (claiming)
+                        {
+                            /* Other segments of the same line */
+                            for (unsigned int s = 0; s < 3; s++)
+                            {
+                                others |= (s != segment) ? segmentCandidates(w, is_row, line, s) : SUDOKU_MASK_NONE;
+                            }
+                        }
+                        else
+                        {
+                            /* Other lines of the same subgrid */
+                            for (unsigned int l = 3 * (line / 3); l < 3 * (line / 3) + 3; l++)
+                            {
+                                others |= (l != line) ? segmentCandidates(w, is_row, l, segment) : SUDOKU_MASK_NONE;
+                            }
+                        }
+
+                        for (uint32_t locked = mask & ~others; SUDOKU_MASK_NONE != locked; locked &= locked - 1)
+                        {
+                            if (hintLocked(w, hint, claiming ? SUDOKU_HINT_CLAIMING : SUDOKU_HINT_POINTING, is_row, line, segment, locked & (~locked + 1)))
+                            {
+                                return 1;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Naked pairs, then hidden pairs.
+     */
+    static int hintFindPair(SudokuPuzzle_P w, Sudoku_Hint_T *hint)
+    {
+        for (unsigned int i = 0; i < 3 * NUM_SUBGRID; i++)
+        {
+            unsigned int unit = (i + 2 * NUM_SUBGRID) % (3 * NUM_SUBGRID);
+            Sudoku_Row_Index_T rows[NUM_SUBGRID_ELEMENTS];
+            Sudoku_Column_Index_T cols[NUM_SUBGRID_ELEMENTS];
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                unitCell(unit, k, &rows[k], &cols[k]);
+            }
+
+            for (unsigned int a = 0; a < NUM_SUBGRID_ELEMENTS; a++)
+            {
+                uint32_t pair = w->grid[rows[a]][cols[a]].candidates;
+
+                if (2 != countCandidatesInMask(pair))
+                {
+                    continue;
+                }
+
+                for (unsigned int b = a + 1; b < NUM_SUBGRID_ELEMENTS; b++)
+                {
+                    if (pair != w->grid[rows[b]][cols[b]].candidates)
+                    {
+                        continue;
+                    }
+
+                    hintStart(hint, SUDOKU_HINT_NAKED_PAIR, unit, pair);
+                    hintAddCell(hint, rows[a], cols[a]);
+                    hintAddCell(hint, rows[b], cols[b]);
+                    for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+                    {
+                        if ((k != a) && (k != b))
+                        {
+                            hintEliminate(hint, rows[k], cols[k], w->grid[rows[k]][cols[k]].candidates & pair);
+                        }
+                    }
+
+                    if (hint->n_eliminations > 0)
+                    {
+                        return 1;
+                    }
+                }
+            }
+        }
+
+        for (unsigned int i = 0; i < 3 * NUM_SUBGRID; i++)
+        {
+            unsigned int unit = (i + 2 * NUM_SUBGRID) % (3 * NUM_SUBGRID);
+            Sudoku_Row_Index_T rows[NUM_SUBGRID_ELEMENTS];
+            Sudoku_Column_Index_T cols[NUM_SUBGRID_ELEMENTS];
+            uint32_t places[NUM_CANDIDATES] = {0}; /* Cells (as unit positions) holding each candidate */
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                unitCell(unit, k, &rows[k], &cols[k]);
+                for (uint32_t c = w->grid[rows[k]][cols[k]].candidates; SUDOKU_MASK_NONE != c; c &= c - 1)
+                {
+                    places[Sudoku_Kernels.lowest(c)] |= (uint32_t)1 << k;
+                }
+            }
+
+            for (unsigned int v1 = 0; v1 < NUM_CANDIDATES; v1++)
+            {
+                if (2 != countCandidatesInMask(places[v1]))
+                {
+                    continue;
+                }
+
+                for (unsigned int v2 = v1 + 1; v2 < NUM_CANDIDATES; v2++)
+                {
+                    if (places[v1] != places[v2])
+                    {
+                        continue;
+                    }
+
+                    uint32_t pair = ((uint32_t)1 << v1) | ((uint32_t)1 << v2);
+
+                    hintStart(hint, SUDOKU_HINT_HIDDEN_PAIR, unit, pair);
+                    for (uint32_t k_mask = places[v1]; SUDOKU_MASK_NONE != k_mask; k_mask &= k_mask - 1)
+                    {
+                        unsigned int k = Sudoku_Kernels.lowest(k_mask);
+                        hintAddCell(hint, rows[k], cols[k]);
+                        hintEliminate(hint, rows[k], cols[k], w->grid[rows[k]][cols[k]].candidates & ~pair);
+                    }
+
+                    if (hint->n_eliminations > 0)
+                    {
+                        return 1;
+                    }
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    Sudoku_RC_T Sudoku_NextHint(SudokuPuzzle_P p, Sudoku_Hint_T *hint)
+    {
+        struct SudokuPuzzle_S w;
+        Sudoku_RC_T rc = SUDOKU_RC_SUCCESS;
+
+        if ((NULL == p) || (NULL == hint))
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        hintStart(hint, SUDOKU_HINT_NONE, 0, SUDOKU_MASK_NONE);
+
+        if (SUDOKU_RC_SUCCESS != hintFindRepeatedValue(p, hint))
+        {
+            return SUDOKU_RC_NOT_SOLVABLE;
+        }
+
+        /* Candidates of the hint: the puzzle candidates restricted by the unit masks of the pruner */
+        (void)memcpy(&w, p, sizeof(w));
+        (void)generateRowMasks(&w);
+        (void)generateColumnMasks(&w);
+        (void)generateSubgridMasks(&w);
+        (void)generatePuzzleCellMasks(&w);
+
+        unsigned int n_empty = 0;
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                if (SUDOKU_MASK_NONE != w.grid[row][col].value)
+                {
+                    w.grid[row][col].candidates = SUDOKU_MASK_NONE;
+                    continue;
+                }
+
+                w.grid[row][col].candidates &= SUDOKU_MASK_ALL;
+                if (SUDOKU_MASK_NONE == w.grid[row][col].candidates)
+                {
+                    return hintContradiction(hint, row, row, col, SUDOKU_MASK_NONE);
+                }
+                n_empty++;
+            }
+        }
+
+        if (0 == n_empty)
+        {
+            return SUDOKU_RC_SUCCESS;
+        }
+
+        if (hintFindSingle(&w, hint, &rc) || hintFindLockedCandidates(&w, hint) || hintFindPair(&w, hint))
+        {
+            return rc;
+        }
+
+        hintStart(hint, SUDOKU_HINT_NONE, 0, SUDOKU_MASK_NONE);
+        return SUDOKU_RC_PRUNE;
+    }
+
+    Sudoku_RC_T Sudoku_ApplyHint(SudokuPuzzle_P p, const Sudoku_Hint_T *hint)
+    {
+        if ((NULL == p) || (NULL == hint))
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        switch (hint->technique)
+        {
+        case SUDOKU_HINT_FULL_HOUSE:
+        case SUDOKU_HINT_NAKED_SINGLE:
+        case SUDOKU_HINT_HIDDEN_SINGLE:
+            return Sudoku_SetValueUsingBitmask(p, hint->cells[0] / NUM_COLS, hint->cells[0] % NUM_COLS, (Sudoku_BitValues_T)hint->values);
+        case SUDOKU_HINT_NONE:
+        case SUDOKU_HINT_CONTRADICTION:
+            return SUDOKU_RC_INVALID_INPUT;
+        default:
+            break;
+        }
+
+        for (unsigned int i = 0; i < hint->n_eliminations; i++)
+        {
+            (void)removeCandidate(p, hint->elim_cells[i] / NUM_COLS, hint->elim_cells[i] % NUM_COLS, hint->elim_candidates[i]);
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    const char *Sudoku_HintName(Sudoku_HintTechnique_T technique)
+    {
+        switch (technique)
+        {
+        case SUDOKU_HINT_FULL_HOUSE:
+            return "Full House";
+        case SUDOKU_HINT_NAKED_SINGLE:
+            return "Naked Single";
+        case SUDOKU_HINT_HIDDEN_SINGLE:
+            return "Hidden Single";
+        case SUDOKU_HINT_POINTING:
+            return "Pointing";
+        case SUDOKU_HINT_CLAIMING:
+            return "Claiming";
+        case SUDOKU_HINT_NAKED_PAIR:
+            return "Naked Pair";
+        case SUDOKU_HINT_HIDDEN_PAIR:
+            return "Hidden Pair";
+        case SUDOKU_HINT_CONTRADICTION:
+            return "Contradiction";
+        default:
+            return "None";
+        }
+    }
+
 #ifdef __cplusplus
 }
 #endif
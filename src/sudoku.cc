@@ -9,14 +9,146 @@
  *
  */
 #include "sudoku.hh"
+#include "sudoku_transposition.hh"
 
-#include <sstream>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
 
 /* Give access to private C-Library*/
 #include "_sudoku.h"
+#include "_sudoku_backjump.h"
+#include "_sudoku_dlx.h"
 
-static unsigned int max_level = 0;
-static unsigned int solve_calls = 0;
+/* Global statistics, updated by concurrent solves once per search */
+static std::atomic<unsigned int> max_level(0);
+static std::atomic<unsigned int> solve_calls(0);
+
+/* Node arena of the Dancing Links engine, reused by every solve on the same thread */
+static thread_local struct SudokuDLX_S dlx_arena;
+
+/* Level states of the backjumping engine, allocated on first use by each thread */
+static thread_local std::unique_ptr<struct SudokuBackjump_S> backjump_workspace;
+
+/* Number of solve calls between two deadline checks */
+static const unsigned int deadline_check_interval = 16;
+
+struct SudokuSearchContext
+{
+    Sudoku_SearchConfig_T config;     /**< Branching configuration. */
+    uint32_t rng_state;               /**< Random tie-breaking state, seeded from the configuration. */
+    const std::atomic<bool> *cancel;  /**< Optional cancellation flag. */
+    SudokuTranspositionTable *table;  /**< Optional table of dead states. */
+    unsigned long max_nodes;          /**< Maximum number of solve calls, 0 for unlimited. */
+    std::chrono::steady_clock::time_point deadline; /**< Wall-clock deadline. */
+    unsigned int max_level;           /**< Maximum recursion level of this search. */
+    unsigned int solve_calls;         /**< Number of solve calls of this search. */
+    unsigned int backtracks;          /**< Number of failed branches of this search. */
+    unsigned int prune_sweeps;        /**< Number of propagation passes of this search. */
+    unsigned int table_probes;        /**< Number of transposition table lookups of this search. */
+    unsigned int table_hits;          /**< Number of lookups answered by the table. */
+    Sudoku_Propagation_T propagation; /**< Propagation strength at every node. */
+    unsigned int probe_budget;        /**< Candidates of bivalue cells probed per node. */
+    Sudoku_PropagationStats_T propagation_stats; /**< Deductions beyond naked singles of this search. */
+    SudokuSelectFunction select;      /**< Optional candidate selection of a policy, replacing the configuration. */
+    const void *policy;               /**< Passed to select. */
+
+    explicit SudokuSearchContext(const Sudoku_SearchConfig_T &c, const std::atomic<bool> *cancel_flag = nullptr,
+                                 SudokuTranspositionTable *t = nullptr)
+        : config(c), rng_state(c.seed), cancel(cancel_flag), table(t), max_nodes(0),
+          deadline(std::chrono::steady_clock::time_point::max()), max_level(0), solve_calls(0),
+          backtracks(0), prune_sweeps(0), table_probes(0), table_hits(0), propagation(SUDOKU_PROPAGATE_SINGLES),
+          probe_budget(0), propagation_stats{}, select(nullptr), policy(nullptr)
+    {
+    }
+
+    /**
+     * @brief Selects the branching candidate of a node with the policy or the configuration.
+     */
+    Sudoku_BitValues_T SelectCandidate(struct SudokuPuzzle_S &puzzle, Sudoku_Row_Index_T &row, Sudoku_Column_Index_T &col)
+    {
+        if (nullptr != select)
+        {
+            return select(&puzzle, policy, (0 != rng_state) ? &rng_state : nullptr, row, col);
+        }
+
+        return Sudoku_SelectCandidateUsingConfig(&puzzle, &config, &rng_state, &row, &col);
+    }
+
+    /**
+     * @brief Prunes, propagates and probes a puzzle at the level and budget of the search.
+     */
+    Sudoku_RC_T Propagate(struct SudokuPuzzle_S &puzzle)
+    {
+        auto rc = Sudoku_ProbePuzzle(&puzzle, propagation, probe_budget, &propagation_stats);
+        prune_sweeps += puzzle.n_sweeps;
+
+        return rc;
+    }
+
+    /**
+     * @brief Checks the cancellation flag and the node and time budgets before a new solve call.
+     *
+     * @return SUDOKU_RC_SUCCESS if the search may continue, SUDOKU_RC_CANCELLED or SUDOKU_RC_BUDGET_EXHAUSTED otherwise.
+     */
+    Sudoku_RC_T CheckBudget(void) const
+    {
+        if ((nullptr != cancel) && cancel->load(std::memory_order_relaxed))
+        {
+            return SUDOKU_RC_CANCELLED;
+        }
+        else if ((0 != max_nodes) && (solve_calls >= max_nodes))
+        {
+            return SUDOKU_RC_BUDGET_EXHAUSTED;
+        }
+        else if ((std::chrono::steady_clock::time_point::max() != deadline) &&
+                 (0 == (solve_calls % deadline_check_interval)) &&
+                 (std::chrono::steady_clock::now() >= deadline))
+        {
+            return SUDOKU_RC_BUDGET_EXHAUSTED;
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+};
+
+static const Sudoku_SearchConfig_T default_search_config = {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, nullptr};
+
+/**
+ * @brief Adds a maximum level and a number of solve calls to the global statistics.
+ */
+static void AccountStats(unsigned int level, unsigned int calls)
+{
+    unsigned int current = max_level.load(std::memory_order_relaxed);
+
+    while ((level > current) && !max_level.compare_exchange_weak(current, level, std::memory_order_relaxed))
+    {
+    }
+    solve_calls.fetch_add(calls, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds the statistics of a finished search to the global statistics.
+ */
+static void AccountSearch(const SudokuSearchContext &ctx)
+{
+    AccountStats(ctx.max_level, ctx.solve_calls);
+}
+
+void SudokuAccumulateStats(SudokuSolveStats &total, const SudokuSolveStats &stats)
+{
+    total.max_level = (stats.max_level > total.max_level) ? stats.max_level : total.max_level;
+    total.solve_calls += stats.solve_calls;
+    total.backtracks += stats.backtracks;
+    total.prune_sweeps += stats.prune_sweeps;
+    total.table_probes += stats.table_probes;
+    total.table_hits += stats.table_hits;
+    Sudoku_AccumulatePropagationStats(&total.propagation, &stats.propagation);
+}
 
 unsigned int GetMaxLevel(void)
 {
@@ -38,67 +170,50 @@ void ResetSolveCalls(void)
     solve_calls = 0;
 }
 
+static_assert(std::is_trivially_copyable<SudokuPuzzle>::value, "puzzles are copied and moved as plain memory");
+
 SudokuPuzzle::SudokuPuzzle(void)
 {
-    this->puzzle = new SudokuPuzzle_S();
     (void)this->InitializePuzzle();
 }
 
 SudokuPuzzle::SudokuPuzzle(const std::string &p)
 {
-    this->puzzle = new SudokuPuzzle_S();
     (void)this->InitializePuzzle(p);
 }
 
 SudokuPuzzle::SudokuPuzzle(SudokuPuzzle_P p)
 {
-    this->puzzle = new SudokuPuzzle_S();
+    (void)this->InitializePuzzle();
     (void)this->InitializePuzzle(p);
 }
 
-SudokuPuzzle::SudokuPuzzle(const SudokuPuzzle &p)
-{
-    this->puzzle = new SudokuPuzzle_S();
-    memcpy(this->puzzle, p.puzzle, sizeof(SudokuPuzzle_S));
-}
-
-SudokuPuzzle::~SudokuPuzzle(void)
+/* Initialize Blank Puzzle*/
+Sudoku_RC_T SudokuPuzzle::InitializePuzzle(void)
 {
-    delete this->puzzle;
+    return Sudoku_InitializePuzzle(&this->puzzle);
 }
 
-SudokuPuzzle &SudokuPuzzle::operator=(const SudokuPuzzle &p)
+Sudoku_RC_T SudokuPuzzle::InitializePuzzle(const std::string &p)
 {
-    if (this == &p)
-    {
-        return *this;
-    }
+    Sudoku_RC_T rc = Sudoku_InitializePuzzle(&this->puzzle);
 
-    if (this->puzzle != nullptr)
+    if (SUDOKU_RC_SUCCESS == rc)
     {
-        delete this->puzzle;
+        rc = Sudoku_InitializeFromArray(&this->puzzle, p.c_str());
     }
 
-    this->puzzle = new SudokuPuzzle_S(*p.puzzle);
-    return *this;
+    return rc;
 }
 
-/* Initialize Blank Puzzle*/
-Sudoku_RC_T SudokuPuzzle::InitializePuzzle(void)
+Sudoku_RC_T SudokuPuzzle::InitializePuzzle(const char *p)
 {
-    return Sudoku_InitializePuzzle(this->puzzle);
+    return Sudoku_InitializeFromArray(&this->puzzle, p);
 }
 
-Sudoku_RC_T SudokuPuzzle::InitializePuzzle(const std::string &p)
+Sudoku_RC_T SudokuPuzzle::InitializePuzzle(const Sudoku_Dataset_T &dataset, uint64_t index)
 {
-    Sudoku_RC_T rc = Sudoku_InitializePuzzle(this->puzzle);
-
-    if (SUDOKU_RC_SUCCESS == rc)
-    {
-        rc = Sudoku_InitializeFromArray(this->puzzle, p.c_str());
-    }
-
-    return rc;
+    return Sudoku_Dataset_Read(&dataset, index, &this->puzzle, NULL);
 }
 
 Sudoku_RC_T SudokuPuzzle::InitializePuzzle(SudokuPuzzle_P p)
@@ -109,7 +224,7 @@ Sudoku_RC_T SudokuPuzzle::InitializePuzzle(SudokuPuzzle_P p)
     }
     else
     {
-        (void)memmove(this->puzzle, p, sizeof(struct SudokuPuzzle_S));
+        (void)memmove(&this->puzzle, p, sizeof(struct SudokuPuzzle_S));
     }
 
     return SUDOKU_RC_SUCCESS;
@@ -140,28 +255,55 @@ Sudoku_RC_T SudokuPuzzle::InitializePuzzle(const SudokuPuzzle &p)
 
 std::string SudokuPuzzle::GetPuzzleAsString(void)
 {
-    std::stringstream puzzle_stream;
+    int8_t values[NUM_ROWS * NUM_COLS];
+    std::string p;
 
-    for (Sudoku_Row_Index_T  r = 0; r < NUM_ROWS; r++)
+    (void)Sudoku_GetValues(&this->puzzle, values);
+
+    p.reserve(NUM_ROWS * NUM_COLS);
+    for (auto val : values)
     {
-        for (Sudoku_Column_Index_T  c = 0; c < NUM_COLS; c++)
+        if (val >= 0)
         {
-            auto val = Sudoku_GetValue(this->puzzle, r, c);
-            puzzle_stream << val;
+            p.push_back((char)('0' + val));
+        }
+        else
+        {
+            p.append(std::to_string(val)); /* Invalid or non-exclusive value */
         }
     }
 
-    return puzzle_stream.str();
+    return p;
+}
+
+Sudoku_RC_T SudokuPuzzle::GetValues(int8_t (&values)[NUM_ROWS * NUM_COLS]) const
+{
+    return Sudoku_GetValues(&this->puzzle, values);
+}
+
+Sudoku_RC_T SudokuPuzzle::GetCandidateMasks(uint32_t (&masks)[NUM_ROWS * NUM_COLS]) const
+{
+    return Sudoku_GetCandidateMasks(&this->puzzle, masks);
+}
+
+uint64_t SudokuPuzzle::GetHash(void) const
+{
+    return Sudoku_GetHash(&this->puzzle);
+}
+
+SudokuPuzzleView SudokuPuzzle::View(void) const
+{
+    return SudokuPuzzleView(Sudoku_GetGrid(&this->puzzle));
 }
 
 Sudoku_RC_T SudokuPuzzle::SetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, Sudoku_Values_T val)
 {
-    return Sudoku_SetValue(this->puzzle, row, col, val);
+    return Sudoku_SetValue(&this->puzzle, row, col, val);
 }
 
 SudokuPuzzle *SudokuPuzzle::SetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, Sudoku_BitValues_T val)
 {
-    if (SUDOKU_RC_SUCCESS == Sudoku_SetValueUsingBitmask(this->puzzle, row, col, val))
+    if (SUDOKU_RC_SUCCESS == Sudoku_SetValueUsingBitmask(&this->puzzle, row, col, val))
     {
         return this;
     }
@@ -170,17 +312,355 @@ SudokuPuzzle *SudokuPuzzle::SetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index
 
 Sudoku_Values_T SudokuPuzzle::GetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col)
 {
-    return (Sudoku_Values_T)Sudoku_GetValue(this->puzzle, row, col);
+    return (Sudoku_Values_T)Sudoku_GetValue(&this->puzzle, row, col);
+}
+
+Sudoku_RC_T SudokuPuzzle::NextHint(Sudoku_Hint_T &hint)
+{
+    return Sudoku_NextHint(&this->puzzle, &hint);
+}
+
+Sudoku_RC_T SudokuPuzzle::ApplyHint(const Sudoku_Hint_T &hint)
+{
+    return Sudoku_ApplyHint(&this->puzzle, &hint);
 }
 
 Sudoku_RC_T SudokuPuzzle::Check(void)
 {
-    return Sudoku_Check(this->puzzle);
+    return Sudoku_Check(&this->puzzle);
 }
 
 Sudoku_RC_T SudokuPuzzle::Solve(void)
 {
-    return Solve(0);
+    return Solve(default_search_config);
+}
+
+Sudoku_RC_T SudokuPuzzle::Solve(const Sudoku_SearchConfig_T &config)
+{
+    SudokuSearchContext ctx(config);
+
+    auto rc = Solve(0, ctx);
+    AccountSearch(ctx);
+
+    return rc;
+}
+
+Sudoku_RC_T SudokuPuzzle::Solve(const SudokuSolveOptions &options, SudokuSolveStats *stats)
+{
+    return Solve(options, stats, nullptr, nullptr);
+}
+
+Sudoku_RC_T SudokuPuzzle::Solve(const SudokuSolveOptions &options, SudokuSolveStats *stats, SudokuSelectFunction select,
+                                const void *policy)
+{
+    SudokuSearchContext ctx(options.config, options.cancel, options.table);
+    ctx.max_nodes = options.max_nodes;
+    ctx.deadline = options.deadline;
+    ctx.propagation = options.propagation;
+    ctx.probe_budget = options.probe_budget;
+    ctx.select = select;
+    ctx.policy = policy;
+
+    auto rc = Solve(0, ctx);
+    AccountSearch(ctx);
+
+    if (nullptr != stats)
+    {
+        stats->max_level = ctx.max_level;
+        stats->solve_calls = ctx.solve_calls;
+        stats->backtracks = ctx.backtracks;
+        stats->prune_sweeps = ctx.prune_sweeps;
+        stats->table_probes = ctx.table_probes;
+        stats->table_hits = ctx.table_hits;
+        stats->propagation = ctx.propagation_stats;
+    }
+
+    return rc;
+}
+
+/**
+ * @brief Element of the Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ...
+ *
+ * @param i Index of the element, starting at 1.
+ */
+static unsigned long Luby(unsigned long i)
+{
+    unsigned long size = 1;
+
+    /* Find the smallest complete subsequence of length 2^k - 1 holding i */
+    while (size < i)
+    {
+        size = 2 * size + 1;
+    }
+
+    while (size != i)
+    {
+        size >>= 1;
+        i = (i > size) ? (i - size) : i;
+    }
+
+    return (size + 1) >> 1;
+}
+
+/**
+ * @brief Tie-breaking seed of a restart, mixed from the configured seed and the restart index.
+ */
+static uint32_t RestartSeed(uint32_t seed, unsigned int run)
+{
+    const uint64_t z = Sudoku_Mix64(((uint64_t)seed << 32) + run);
+
+    /* A zero seed disables random tie-breaking */
+    return (0 == (uint32_t)z) ? 1u : (uint32_t)z;
+}
+
+/**
+ * @brief Hash of the values and candidates of a pruned puzzle, the key of a subtree count.
+ *
+ * Candidate keys use cell indexes after those of the Zobrist value keys.
+ */
+static uint64_t CountKey(SudokuPuzzle_P p)
+{
+    uint64_t key = p->hash;
+
+    for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+    {
+        const uint32_t candidates = p->grid[cell / NUM_COLS][cell % NUM_COLS].candidates;
+
+        if (SUDOKU_MASK_NONE != candidates)
+        {
+            key ^= Sudoku_Mix64(((uint64_t)(NUM_ROWS * NUM_COLS + cell) << 16) | candidates);
+        }
+    }
+
+    return key;
+}
+
+unsigned long SudokuPuzzle::RestartLimit(const SudokuRestartOptions &options, unsigned int run)
+{
+    const unsigned long base = (0 == options.base_nodes) ? 1 : options.base_nodes;
+
+    if (SUDOKU_RESTART_GEOMETRIC == options.schedule)
+    {
+        const double limit = (double)base * std::pow((options.factor < 1.0) ? 1.0 : options.factor, (double)run);
+
+        return (limit >= (double)(ULONG_MAX / 2)) ? (ULONG_MAX / 2) : (unsigned long)limit;
+    }
+
+    return base * Luby((unsigned long)run + 1);
+}
+
+Sudoku_RC_T SudokuPuzzle::SolveWithRestarts(const SudokuRestartOptions &options, SudokuRestartStats *stats)
+{
+    const auto no_deadline = std::chrono::steady_clock::time_point::max();
+    SudokuSolveOptions run_options = options.solve;
+    SudokuSolveStats total = {};
+    Sudoku_RC_T rc = SUDOKU_RC_BUDGET_EXHAUSTED;
+
+    if (nullptr != stats)
+    {
+        stats->runs.clear();
+    }
+
+    for (unsigned int run = 0;; run++)
+    {
+        const bool last = (0 != options.max_restarts) && (run >= options.max_restarts);
+        unsigned long limit = last ? 0 : RestartLimit(options, run);
+        bool out_of_budget = false;
+
+        /* The overall node budget caps the limit of the run */
+        if (0 != options.solve.max_nodes)
+        {
+            const unsigned long remaining = options.solve.max_nodes - total.solve_calls;
+
+            if ((0 == limit) || (remaining <= limit))
+            {
+                limit = remaining;
+                out_of_budget = true;
+            }
+        }
+
+        SudokuSolveStats run_stats = {};
+        run_options.max_nodes = limit;
+        run_options.config.seed = RestartSeed(options.solve.config.seed, run);
+
+        rc = Solve(run_options, &run_stats);
+
+        SudokuAccumulateStats(total, run_stats);
+
+        if (nullptr != stats)
+        {
+            stats->runs.push_back({run_options.config.seed, limit, rc, run_stats});
+        }
+
+        /* Refuted candidates stay eliminated, so the next run continues from the pruned puzzle */
+        if ((SUDOKU_RC_BUDGET_EXHAUSTED != rc) || out_of_budget ||
+            ((no_deadline != options.solve.deadline) && (std::chrono::steady_clock::now() >= options.solve.deadline)))
+        {
+            break;
+        }
+    }
+
+    if (nullptr != stats)
+    {
+        stats->total = total;
+    }
+
+    return rc;
+}
+
+Sudoku_RC_T SudokuPuzzle::Solve(const Sudoku_Heuristic_T &heuristic, SudokuSolveStats *stats)
+{
+    SudokuSolveOptions options;
+    options.config.heuristic = &heuristic;
+
+    return Solve(options, stats);
+}
+
+std::vector<Sudoku_SearchConfig_T> SudokuPuzzle::DefaultPortfolio(void)
+{
+    return {
+        {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, nullptr},
+        {SUDOKU_SCORE_MRV, SUDOKU_ORDER_LEAST_FREQUENT, 0, nullptr},
+        {SUDOKU_SCORE_UNITS, SUDOKU_ORDER_MOST_FREQUENT, 0x9E3779B9u, nullptr},
+        {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_ASCENDING, 0x2545F491u, nullptr},
+    };
+}
+
+Sudoku_RC_T SudokuPuzzle::SolvePortfolio(SudokuPortfolioResult &result, const std::vector<Sudoku_SearchConfig_T> &configs,
+                                         SudokuTranspositionTable *table)
+{
+    const size_t n_configs = configs.size();
+
+    if (0 == n_configs)
+    {
+        return SUDOKU_RC_INVALID_INPUT;
+    }
+
+    std::atomic<bool> cancel(false);
+    std::atomic<size_t> winner(n_configs);
+    std::vector<SudokuPuzzle> workers(n_configs, *this);
+    std::vector<SudokuSearchContext> contexts;
+    std::vector<Sudoku_RC_T> results(n_configs, SUDOKU_RC_CANCELLED);
+    std::vector<std::thread> threads;
+
+    contexts.reserve(n_configs);
+    for (const auto &config : configs)
+    {
+        contexts.emplace_back(config, &cancel, table);
+    }
+
+    auto race = [&](size_t idx)
+    {
+        results[idx] = workers[idx].Solve(0, contexts[idx]);
+
+        size_t no_winner = n_configs;
+        if ((SUDOKU_RC_CANCELLED != results[idx]) && winner.compare_exchange_strong(no_winner, idx))
+        {
+            cancel.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    /* The calling thread races the first configuration itself */
+    threads.reserve(n_configs - 1);
+    for (size_t idx = 1; idx < n_configs; idx++)
+    {
+        threads.emplace_back(race, idx);
+    }
+    race(0);
+
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    const size_t idx = winner.load();
+
+    *this = workers[idx];
+    AccountSearch(contexts[idx]);
+
+    result.rc = results[idx];
+    result.winner = idx;
+    result.config = configs[idx];
+    result.max_level = contexts[idx].max_level;
+    result.solve_calls = contexts[idx].solve_calls;
+
+    return result.rc;
+}
+
+/**
+ * @brief Runs the Dancing Links engine on a puzzle and accounts its statistics.
+ *
+ * @param p Puzzle to solve.
+ * @param limit Maximum number of solutions to search for.
+ * @return Sudoku_RC_T Result code.
+ */
+static Sudoku_RC_T SolveDLX(SudokuPuzzle_P p, unsigned long limit)
+{
+    auto rc = Sudoku_DLX_Solve(&dlx_arena, p, limit);
+
+    AccountStats(dlx_arena.max_level, (unsigned int)dlx_arena.n_nodes_visited);
+
+    return rc;
+}
+
+/**
+ * @brief Runs the backjumping engine on a puzzle and accounts its statistics.
+ *
+ * @param p Puzzle to solve.
+ * @return Sudoku_RC_T Result code.
+ */
+static Sudoku_RC_T SolveBackjump(SudokuPuzzle_P p)
+{
+    if (nullptr == backjump_workspace)
+    {
+        backjump_workspace.reset(new SudokuBackjump_S);
+    }
+
+    auto rc = Sudoku_Backjump_Solve(backjump_workspace.get(), p, &default_search_config);
+
+    AccountStats(backjump_workspace->max_level, (unsigned int)backjump_workspace->n_nodes_visited);
+
+    return rc;
+}
+
+Sudoku_RC_T SudokuPuzzle::Solve(Sudoku_Engine_T engine)
+{
+    if (SUDOKU_ENGINE_BACKJUMP == engine)
+    {
+        return SolveBackjump(&this->puzzle);
+    }
+    else if (SUDOKU_ENGINE_DLX != engine)
+    {
+        return Solve();
+    }
+
+    auto rc = SolveDLX(&this->puzzle, 1);
+
+    if (SUDOKU_RC_SUCCESS == rc)
+    {
+        rc = Sudoku_DLX_StoreSolution(&dlx_arena, &this->puzzle);
+    }
+
+    return rc;
+}
+
+Sudoku_RC_T SudokuPuzzle::CountSolutions(unsigned long &count, unsigned long limit, Sudoku_Engine_T engine,
+                                         SudokuTranspositionTable *table)
+{
+    count = 0;
+
+    if (SUDOKU_ENGINE_DLX == engine)
+    {
+        auto rc = SolveDLX(&this->puzzle, limit);
+        count = dlx_arena.n_solutions;
+        return rc;
+    }
+
+    /* Work on a copy, the puzzle itself stays untouched */
+    SudokuPuzzle p_work(*this);
+    p_work.Count(0, (limit > 0) ? limit : 1, count, table);
+
+    return (count > 0) ? SUDOKU_RC_SUCCESS : SUDOKU_RC_ERROR;
 }
 
 /**
@@ -195,26 +675,52 @@ Sudoku_RC_T SudokuPuzzle::Solve(void)
  * 6. If the recursive call succeeds, overwrite the current puzzle with the new puzzle.
  * 7. If the recursive call fails, remove the candidate value from the current puzzle and repeat the pruning.
  *
+ * With a transposition table, a state whose values were proven dead before is refuted without search,
+ * and every state proven dead here is stored. The values alone identify the state, since the only
+ * candidates removed during the search are those refuted under a subset of the values.
+ *
+ * The search stops with SUDOKU_RC_CANCELLED as soon as the cancellation flag of the context is raised,
+ * and with SUDOKU_RC_BUDGET_EXHAUSTED once the node or time budget of the context runs out. Only a
+ * successful branch overwrites the current puzzle, so it always keeps a consistent pruned state.
+ *
  * @param level Level of recursion.
+ * @param ctx Search configuration, cancellation and statistics.
  * @return Sudoku_RC_T Result code.
  */
-Sudoku_RC_T SudokuPuzzle::Solve(unsigned int level)
+Sudoku_RC_T SudokuPuzzle::Solve(unsigned int level, SudokuSearchContext &ctx)
 {
-    max_level = (level > max_level) ? level : max_level;
-    solve_calls++;
+    auto budget_rc = ctx.CheckBudget();
+    if (SUDOKU_RC_SUCCESS != budget_rc)
+    {
+        return budget_rc;
+    }
+
+    ctx.max_level = (level > ctx.max_level) ? level : ctx.max_level;
+    ctx.solve_calls++;
 
     /* Prune and Validate Grid */
-    auto rc = Sudoku_PrunePuzzle(this->puzzle);
+    auto rc = ctx.Propagate(this->puzzle);
+
+    const uint64_t key = ((nullptr != ctx.table) && (SUDOKU_RC_PRUNE == rc)) ? this->puzzle.hash : 0;
+    if (0 != key)
+    {
+        ctx.table_probes++;
+        if (ctx.table->IsDead(key))
+        {
+            ctx.table_hits++;
+            return SUDOKU_RC_ERROR;
+        }
+    }
 
     while (rc == SUDOKU_RC_PRUNE)
     {
         Sudoku_Row_Index_T row = 0;
         Sudoku_Column_Index_T col = 0;
-        auto cand = Sudoku_SelectCandidate(this->puzzle, &row, &col);
+        auto cand = ctx.SelectCandidate(this->puzzle, row, col);
 
         SudokuPuzzle p_new(*this);
 
-        rc = (p_new.SetValue(row, col, cand))->Solve(level + 1);
+        rc = (p_new.SetValue(row, col, cand))->Solve(level + 1, ctx);
 
         if (SUDOKU_RC_SUCCESS == rc)
         {
@@ -223,10 +729,72 @@ Sudoku_RC_T SudokuPuzzle::Solve(unsigned int level)
         }
         else if (SUDOKU_RC_ERROR == rc)
         {
-            (void)Sudoku_RemoveCandidate(this->puzzle, row, col, cand);
-            rc = Sudoku_PrunePuzzle(this->puzzle);
+            ctx.backtracks++;
+            (void)Sudoku_RemoveCandidate(&this->puzzle, row, col, cand);
+            rc = ctx.Propagate(this->puzzle);
         }
     }
 
+    if ((0 != key) && (SUDOKU_RC_ERROR == rc))
+    {
+        ctx.table->Store(key, 0);
+    }
+
     return rc;
 }
+
+/**
+ * @brief Recursively counts the solutions of the Sudoku Puzzle.
+ *
+ * Same pruning and branching as Solve(), but instead of returning on the first
+ * solution, the remaining candidates are explored until the limit is reached.
+ *
+ * Counting removes candidates of explored branches that do have solutions, so a counting
+ * state is identified by its values and candidates (see CountKey()). Subtrees explored before
+ * the limit was reached are stored in the table with their exact number of solutions.
+ *
+ * @param level Level of recursion.
+ * @param limit Maximum number of solutions to count.
+ * @param count Number of solutions found so far.
+ * @param table Optional table of subtree counts.
+ */
+void SudokuPuzzle::Count(unsigned int level, unsigned long limit, unsigned long &count, SudokuTranspositionTable *table)
+{
+    AccountStats(level, 1);
+
+    auto rc = Sudoku_PrunePuzzle(&this->puzzle);
+
+    const uint64_t key = ((nullptr != table) && (SUDOKU_RC_PRUNE == rc)) ? CountKey(&this->puzzle) : 0;
+    const unsigned long start = count;
+    uint64_t cached = 0;
+
+    if ((0 != key) && table->Probe(key, cached))
+    {
+        count = (cached < (uint64_t)(limit - count)) ? (count + (unsigned long)cached) : limit;
+        return;
+    }
+
+    while ((SUDOKU_RC_PRUNE == rc) && (count < limit))
+    {
+        Sudoku_Row_Index_T row = 0;
+        Sudoku_Column_Index_T col = 0;
+        auto cand = Sudoku_SelectCandidate(&this->puzzle, &row, &col);
+
+        SudokuPuzzle p_new(*this);
+
+        (p_new.SetValue(row, col, cand))->Count(level + 1, limit, count, table);
+
+        (void)Sudoku_RemoveCandidate(&this->puzzle, row, col, cand);
+        rc = Sudoku_PrunePuzzle(&this->puzzle);
+    }
+
+    if ((SUDOKU_RC_SUCCESS == rc) && (count < limit))
+    {
+        count++;
+    }
+
+    if ((0 != key) && (count < limit))
+    {
+        table->Store(key, count - start);
+    }
+}
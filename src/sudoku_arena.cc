@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @brief Per-thread arena for batch workloads
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_arena.hh"
+
+#include <algorithm>
+
+SudokuArena::SudokuArena(size_t chunk_size) : chunk_size(chunk_size)
+{
+}
+
+SudokuArena::~SudokuArena(void)
+{
+    while (nullptr != first)
+    {
+        Chunk *next = first->next;
+        ::operator delete(first);
+        first = next;
+    }
+}
+
+void *SudokuArena::Allocate(size_t size, size_t alignment)
+{
+    uintptr_t address = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+    if ((nullptr == cursor) || (address + size > reinterpret_cast<uintptr_t>(limit)))
+    {
+        NextChunk(size, alignment);
+        address = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    }
+
+    char *memory = reinterpret_cast<char *>(address);
+    bytes_in_use += (size_t)(memory + size - cursor);
+    cursor = memory + size;
+    n_allocations++;
+
+    return memory;
+}
+
+void SudokuArena::NextChunk(size_t size, size_t alignment)
+{
+    const size_t needed = size + alignment;
+
+    /* Chunks of earlier batches first */
+    while ((nullptr != current) && (nullptr != current->next))
+    {
+        current = current->next;
+        cursor = Begin(current);
+        limit = cursor + current->size;
+
+        if (current->size >= needed)
+        {
+            return;
+        }
+    }
+
+    const size_t chunk_bytes = std::max(chunk_size, needed);
+    Chunk *chunk = static_cast<Chunk *>(::operator new(sizeof(Chunk) + chunk_bytes));
+    chunk->next = nullptr;
+    chunk->size = chunk_bytes;
+    n_upstream++;
+    capacity += chunk_bytes;
+
+    if (nullptr == current)
+    {
+        first = chunk;
+    }
+    else
+    {
+        current->next = chunk;
+    }
+
+    current = chunk;
+    cursor = Begin(chunk);
+    limit = cursor + chunk_bytes;
+}
+
+void SudokuArena::Reset(void)
+{
+    current = first;
+    cursor = (nullptr != first) ? Begin(first) : nullptr;
+    limit = (nullptr != first) ? cursor + first->size : nullptr;
+    bytes_in_use = 0;
+    n_resets++;
+}
+
+SudokuArena &SudokuArena::ThreadLocal(void)
+{
+    static thread_local SudokuArena arena;
+    return arena;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file
+ * @brief Asynchronous solve API on a shared executor
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_async.hh"
+
+struct SudokuSolveState
+{
+    SudokuSolveState(const SudokuPuzzle &p, const SudokuSolveOptions &o)
+        : puzzle(p), options(o), cancel(false), done(false), rc(SUDOKU_RC_ERROR), stats{}
+    {
+        options.cancel = &cancel;
+    }
+
+    SudokuPuzzle puzzle;
+    SudokuSolveOptions options;
+    std::atomic<bool> cancel;
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable completed;
+    bool done;
+    Sudoku_RC_T rc;
+    SudokuSolveStats stats;
+    std::vector<SudokuSolveCallback> callbacks;
+};
+
+SudokuExecutor::SudokuExecutor(unsigned int n_threads) : stopping(false)
+{
+    if (0 == n_threads)
+    {
+        n_threads = std::thread::hardware_concurrency();
+        n_threads = (n_threads > 0) ? n_threads : 1;
+    }
+
+    threads.reserve(n_threads);
+    for (unsigned int i = 0; i < n_threads; i++)
+    {
+        threads.emplace_back(&SudokuExecutor::Run, this);
+    }
+}
+
+SudokuExecutor::~SudokuExecutor(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    not_empty.notify_all();
+
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+}
+
+void SudokuExecutor::Submit(std::function<void(void)> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    not_empty.notify_one();
+}
+
+SudokuExecutor &SudokuExecutor::Shared(void)
+{
+    static SudokuExecutor shared;
+    return shared;
+}
+
+void SudokuExecutor::Run(void)
+{
+    for (;;)
+    {
+        std::function<void(void)> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            not_empty.wait(lock, [this]
+                           { return stopping || !tasks.empty(); });
+
+            if (tasks.empty())
+            {
+                return; /* Stopping and drained */
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+SudokuSolveHandle::SudokuSolveHandle(std::shared_ptr<SudokuSolveState> state) : state(std::move(state))
+{
+}
+
+bool SudokuSolveHandle::Valid(void) const
+{
+    return nullptr != state;
+}
+
+bool SudokuSolveHandle::Ready(void) const
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->done;
+}
+
+Sudoku_RC_T SudokuSolveHandle::Wait(void) const
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->completed.wait(lock, [this]
+                          { return state->done; });
+    return state->rc;
+}
+
+bool SudokuSolveHandle::WaitFor(std::chrono::steady_clock::duration timeout) const
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+    return state->completed.wait_for(lock, timeout, [this]
+                                     { return state->done; });
+}
+
+Sudoku_RC_T SudokuSolveHandle::Get(SudokuPuzzle &puzzle) const
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->completed.wait(lock, [this]
+                          { return state->done; });
+    puzzle = state->puzzle;
+    return state->rc;
+}
+
+SudokuSolveStats SudokuSolveHandle::Stats(void) const
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->stats;
+}
+
+void SudokuSolveHandle::Cancel(void)
+{
+    state->cancel = true;
+}
+
+void SudokuSolveHandle::Then(SudokuSolveCallback callback)
+{
+    if (!ThenIfPending(callback))
+    {
+        callback(state->rc, state->puzzle);
+    }
+}
+
+bool SudokuSolveHandle::ThenIfPending(SudokuSolveCallback callback)
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    if (state->done)
+    {
+        return false;
+    }
+
+    state->callbacks.push_back(std::move(callback));
+    return true;
+}
+
+SudokuSolveHandle SolveAsync(const SudokuPuzzle &puzzle, const SudokuSolveOptions &options, SudokuExecutor &executor)
+{
+    auto state = std::make_shared<SudokuSolveState>(puzzle, options);
+
+    executor.Submit([state]()
+                    {
+        SudokuSolveStats stats = {};
+        Sudoku_RC_T rc = state->cancel ? SUDOKU_RC_CANCELLED : state->puzzle.Solve(state->options, &stats);
+        std::vector<SudokuSolveCallback> callbacks;
+
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->rc = rc;
+            state->stats = stats;
+            state->done = true;
+            callbacks.swap(state->callbacks);
+        }
+        state->completed.notify_all();
+
+        for (auto &callback : callbacks)
+        {
+            callback(rc, state->puzzle);
+        } });
+
+    return SudokuSolveHandle(state);
+}
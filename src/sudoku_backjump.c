@@ -0,0 +1,299 @@
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "_sudoku.h"
+#include "_sudoku_backjump.h"
+#include "_sudoku_kernels.h"
+
+#include <string.h>
+
+    /**
+     * @brief Decision set of the decision taken at a level (1 for the first decision).
+     */
+    static inline Sudoku_Decisions_T decisionBit(unsigned int level)
+    {
+        return (Sudoku_Decisions_T)1 << ((level <= 64) ? (level - 1) : 63);
+    }
+
+    /**
+     * @brief Decisions all eliminated candidates of a cell depend on, except those of a value mask.
+     */
+    static Sudoku_Decisions_T eliminationReasons(const struct SudokuBackjumpState_S *s, unsigned int cell, uint32_t except)
+    {
+        Sudoku_Decisions_T reason = 0;
+
+        for (uint32_t eliminated = SUDOKU_MASK_ALL & ~(s->puzzle.grid[cell / NUM_COLS][cell % NUM_COLS].candidates | except);
+             eliminated != 0; eliminated &= eliminated - 1)
+        {
+            reason |= s->elim_reason[cell][Sudoku_Kernels.lowest(eliminated)];
+        }
+
+        return reason;
+    }
+
+    /**
+     * @brief Places a value and queues the cell for propagation.
+     */
+    static void assignValue(struct SudokuBackjumpState_S *s, unsigned int cell, uint32_t value, Sudoku_Decisions_T reason,
+                            uint8_t *queue, unsigned int *n_queue)
+    {
+        const Sudoku_Row_Index_T row = (Sudoku_Row_Index_T)(cell / NUM_COLS);
+        const Sudoku_Column_Index_T col = (Sudoku_Column_Index_T)(cell % NUM_COLS);
+
+        (void)Sudoku_SetValueUsingBitmask(&s->puzzle, row, col, (Sudoku_BitValues_T)value);
+        s->value_reason[cell] = reason;
+        s->puzzle.row_candidates[row] &= ~value;
+        s->puzzle.col_candidates[col] &= ~value;
+        s->puzzle.sub_candidates[row / 3][col / 3] &= ~value;
+        s->puzzle.n_filled++;
+
+        queue[(*n_queue)++] = (uint8_t)cell;
+    }
+
+    /**
+     * @brief Eliminates a candidate of a cell, placing the cell value if a single candidate is left.
+     *
+     * @return SUDOKU_RC_SUCCESS, or SUDOKU_RC_ERROR with the decisions of the contradiction in @p conflict.
+     */
+    static Sudoku_RC_T eliminate(struct SudokuBackjumpState_S *s, unsigned int cell, uint32_t value, Sudoku_Decisions_T reason,
+                                 uint8_t *queue, unsigned int *n_queue, Sudoku_Decisions_T *conflict)
+    {
+        uint32_t *candidates = &s->puzzle.grid[cell / NUM_COLS][cell % NUM_COLS].candidates;
+
+        *candidates &= ~value;
+        s->elim_reason[cell][Sudoku_Kernels.lowest(value)] = reason;
+
+        const uint32_t remaining = *candidates & SUDOKU_MASK_ALL;
+
+        if (SUDOKU_MASK_NONE == remaining)
+        {
+            *conflict = eliminationReasons(s, cell, SUDOKU_MASK_NONE);
+            return SUDOKU_RC_ERROR;
+        }
+        else if (0 == (remaining & (remaining - 1)))
+        {
+            assignValue(s, cell, remaining, eliminationReasons(s, cell, remaining), queue, n_queue);
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    /**
+     * @brief Removes the values of the queued cells from their peers until no new value is placed.
+     *
+     * @return SUDOKU_RC_SUCCESS, or SUDOKU_RC_ERROR with the decisions of the contradiction in @p conflict.
+     */
+    static Sudoku_RC_T propagate(struct SudokuBackjumpState_S *s, uint8_t *queue, unsigned int n_queue, Sudoku_Decisions_T *conflict)
+    {
+        for (unsigned int head = 0; head < n_queue; head++)
+        {
+            const unsigned int cell = queue[head];
+            const unsigned int row = cell / NUM_COLS;
+            const unsigned int col = cell % NUM_COLS;
+            const uint32_t value = s->puzzle.grid[row][col].value;
+            const Sudoku_Decisions_T reason = s->value_reason[cell];
+
+            /* Row and column, then the subgrid cells outside them */
+            for (unsigned int k = 0; k < 2 * NUM_CANDIDATES + 4; k++)
+            {
+                unsigned int peer;
+
+                if (k < NUM_COLS)
+                {
+                    peer = row * NUM_COLS + k;
+                }
+                else if (k < NUM_COLS + NUM_ROWS)
+                {
+                    peer = (k - NUM_COLS) * NUM_COLS + col;
+                }
+                else
+                {
+                    const unsigned int i = k - NUM_COLS - NUM_ROWS;
+                    const unsigned int sub_row = 3 * (row / 3) + (row % 3 + 1 + i / 2) % 3;
+                    const unsigned int sub_col = 3 * (col / 3) + (col % 3 + 1 + i % 2) % 3;
+                    peer = sub_row * NUM_COLS + sub_col;
+                }
+
+                if (peer == cell)
+                {
+                    continue;
+                }
+
+                const struct SudokuCell_S *p_cell = &s->puzzle.grid[peer / NUM_COLS][peer % NUM_COLS];
+
+                if (p_cell->value == value)
+                {
+                    *conflict = reason | s->value_reason[peer];
+                    return SUDOKU_RC_ERROR;
+                }
+                else if ((p_cell->candidates & value) &&
+                         (SUDOKU_RC_SUCCESS != eliminate(s, peer, value, reason, queue, &n_queue, conflict)))
+                {
+                    return SUDOKU_RC_ERROR;
+                }
+            }
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    /**
+     * @brief Searches the state of a level. On success, the solution is left in the state of the level.
+     *
+     * @return SUDOKU_RC_SUCCESS, or SUDOKU_RC_ERROR with the decisions of the contradiction in @p conflict.
+     */
+    static Sudoku_RC_T searchLevel(struct SudokuBackjump_S *bj, unsigned int level, Sudoku_Decisions_T *conflict)
+    {
+        struct SudokuBackjumpState_S *s = &bj->states[level];
+        uint8_t queue[NUM_ROWS * NUM_COLS];
+
+        bj->n_nodes_visited++;
+        bj->max_level = (level > bj->max_level) ? level : bj->max_level;
+
+        while ((NUM_ROWS * NUM_COLS) != s->puzzle.n_filled)
+        {
+            Sudoku_Row_Index_T row = 0;
+            Sudoku_Column_Index_T col = 0;
+            Sudoku_BitValues_T cand = Sudoku_SelectCandidateUsingConfig(&s->puzzle, &bj->config, &bj->rng_state, &row, &col);
+
+            if ((SUDOKU_BIT_INVALID_VALUE == cand) || (level + 1 >= SUDOKU_BACKJUMP_LEVELS))
+            {
+                *conflict = ~(Sudoku_Decisions_T)0;
+                return SUDOKU_RC_ERROR;
+            }
+
+            const unsigned int cell = row * NUM_COLS + col;
+            const Sudoku_Decisions_T decision = decisionBit(level + 1);
+            struct SudokuBackjumpState_S *child = &bj->states[level + 1];
+            unsigned int n_queue = 0;
+            Sudoku_Decisions_T cs = 0;
+
+            *child = *s;
+            assignValue(child, cell, (uint32_t)cand, decision, queue, &n_queue);
+
+            Sudoku_RC_T rc = propagate(child, queue, n_queue, &cs);
+            if (SUDOKU_RC_SUCCESS == rc)
+            {
+                rc = searchLevel(bj, level + 1, &cs);
+            }
+
+            if (SUDOKU_RC_SUCCESS == rc)
+            {
+                s->puzzle = child->puzzle;
+                return SUDOKU_RC_SUCCESS;
+            }
+            else if (0 == (cs & decision))
+            {
+                /* The contradiction does not depend on this decision: no other value can fix it */
+                bj->n_levels_skipped++;
+                bj->jumping = 1;
+                *conflict = cs;
+                return SUDOKU_RC_ERROR;
+            }
+
+            if (bj->jumping)
+            {
+                bj->n_backjumps++;
+                bj->jumping = 0;
+            }
+
+            /* Refute the value under the earlier decisions involved. Bit 63 may stand for other levels too. */
+            n_queue = 0;
+            rc = eliminate(s, cell, (uint32_t)cand, (level + 1 < 64) ? (cs & ~decision) : cs, queue, &n_queue, conflict);
+            if ((SUDOKU_RC_SUCCESS != rc) || (SUDOKU_RC_SUCCESS != propagate(s, queue, n_queue, conflict)))
+            {
+                return SUDOKU_RC_ERROR;
+            }
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_RC_T Sudoku_Backjump_Solve(struct SudokuBackjump_S *bj, SudokuPuzzle_P p, const Sudoku_SearchConfig_T *config)
+    {
+        static const Sudoku_SearchConfig_T default_config = {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL};
+        struct SudokuBackjumpState_S *s;
+        uint8_t queue[NUM_ROWS * NUM_COLS];
+        unsigned int n_queue = 0;
+        Sudoku_Decisions_T conflict = 0;
+
+        if ((NULL == bj) || (NULL == p))
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        bj->config = (NULL != config) ? *config : default_config;
+        bj->rng_state = bj->config.seed;
+        bj->jumping = 0;
+        bj->n_nodes_visited = 0;
+        bj->max_level = 0;
+        bj->n_backjumps = 0;
+        bj->n_levels_skipped = 0;
+
+        /* Root state: the values of the puzzle and its remaining candidates, depending on no decision */
+        s = &bj->states[0];
+        s->puzzle = *p;
+        s->puzzle.hash = 0;
+        (void)memset(s->value_reason, 0, sizeof(s->value_reason));
+        (void)memset(s->elim_reason, 0, sizeof(s->elim_reason));
+        s->puzzle.n_filled = 0;
+        for (unsigned int i = 0; i < NUM_ROWS; i++)
+        {
+            s->puzzle.row_candidates[i] = SUDOKU_MASK_ALL;
+            s->puzzle.col_candidates[i] = SUDOKU_MASK_ALL;
+            s->puzzle.sub_candidates[i / 3][i % 3] = SUDOKU_MASK_ALL;
+        }
+
+        for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+        {
+            struct SudokuCell_S *c = &s->puzzle.grid[cell / NUM_COLS][cell % NUM_COLS];
+            const uint32_t value = c->value;
+
+            if (SUDOKU_MASK_NONE == value)
+            {
+                c->candidates &= SUDOKU_MASK_ALL;
+                continue;
+            }
+            else if ((value & ~SUDOKU_MASK_ALL) || (value & (value - 1)))
+            {
+                return SUDOKU_RC_ERROR;
+            }
+
+            c->value = SUDOKU_MASK_NONE;
+            assignValue(s, cell, value, 0, queue, &n_queue);
+        }
+
+        for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+        {
+            const struct SudokuCell_S *c = &s->puzzle.grid[cell / NUM_COLS][cell % NUM_COLS];
+
+            if (SUDOKU_MASK_NONE != c->value)
+            {
+                continue;
+            }
+            else if (SUDOKU_MASK_NONE == c->candidates)
+            {
+                return SUDOKU_RC_ERROR;
+            }
+            else if (0 == (c->candidates & (c->candidates - 1)))
+            {
+                assignValue(s, cell, c->candidates, 0, queue, &n_queue);
+            }
+        }
+
+        if ((SUDOKU_RC_SUCCESS != propagate(s, queue, n_queue, &conflict)) ||
+            (SUDOKU_RC_SUCCESS != searchLevel(bj, 0, &conflict)))
+        {
+            return SUDOKU_RC_ERROR;
+        }
+
+        *p = s->puzzle;
+
+        return Sudoku_PrunePuzzle(p);
+    }
+
+#ifdef __cplusplus
+}
+#endif
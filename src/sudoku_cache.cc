@@ -0,0 +1,614 @@
+/**
+ * @file
+ * @brief Canonical-form symmetry hashing and in-process solution cache
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_cache.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+/* Give access to private C-Library*/
+#include "_sudoku.h"
+
+/**
+ * @brief Partial canonical transformation: the rows chosen so far and the complete column order.
+ */
+struct CanonState
+{
+    uint8_t transpose;
+    uint8_t n_labels;                  /**< Number of digits relabelled so far. */
+    uint8_t rows[NUM_ROWS];
+    uint8_t cols[NUM_COLS];
+    uint8_t label[NUM_CANDIDATES + 1]; /**< Canonical label of each original digit, 0 if not seen yet. */
+};
+
+/* Maximum number of tied partial transformations, only reached by highly symmetric puzzles */
+static const size_t canon_beam_limit = 1 << 8;
+
+/* Puzzles with fewer clues have no unique solution and too many symmetries to canonicalize cheaply */
+static const unsigned int canon_min_clues = 17;
+
+/* Beams are reused by every canonicalization on the same thread */
+static thread_local std::vector<CanonState> beam_current;
+static thread_local std::vector<CanonState> beam_next;
+
+/**
+ * @brief Search state of the canonicalization.
+ */
+struct CanonSearch
+{
+    uint8_t grid[2][NUM_ROWS][NUM_COLS];     /**< Puzzle digits, as is and transposed. */
+    uint8_t clues[2][NUM_ROWS];              /**< Clues per row, as is and transposed (i.e. per column). */
+    uint8_t band_clues[2][NUM_SUBGRID_ROWS]; /**< Clues per band, as is and transposed (i.e. per stack). */
+    uint8_t first[NUM_COLS];                 /**< Smallest first row found so far. */
+    uint8_t best[NUM_COLS];                  /**< Smallest row found so far for the current canonical row. */
+    uint8_t prefix[NUM_COLS];                /**< First row under construction. */
+    bool overflow;
+};
+
+/**
+ * @brief Checks that a row (or column) is the next one in clue count order.
+ *
+ * The canonical form orders bands by clue count and the rows within each band by clue count, and
+ * likewise for stacks and columns. Both are invariant under the symmetries, so the ordering only
+ * restricts the search to fewer ties without changing which puzzles share a key.
+ *
+ * @param clues Clues per row.
+ * @param band_clues Clues per band.
+ * @param used_rows Rows placed so far.
+ * @param row The row to place next, either in a new band or in the band of the previous row.
+ */
+static bool CanonIsNextByClues(const uint8_t clues[NUM_ROWS], const uint8_t band_clues[NUM_SUBGRID_ROWS], unsigned int used_rows, unsigned int row)
+{
+    const unsigned int band = row / NUM_SUBGRID_ROWS;
+
+    for (unsigned int other = 0; other < NUM_ROWS; other++)
+    {
+        const unsigned int other_band = other / NUM_SUBGRID_ROWS;
+
+        if (used_rows & (1u << other))
+        {
+            continue;
+        }
+        else if (other_band == band)
+        {
+            if (clues[other] < clues[row])
+            {
+                return false;
+            }
+        }
+        else if ((0 == (used_rows & (0x7u << (NUM_SUBGRID_ROWS * other_band)))) && (band_clues[other_band] < band_clues[band]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Pushes a tied or better state into the next beam.
+ */
+static void CanonPush(CanonSearch &search, const CanonState &state, const uint8_t row[NUM_COLS], int cmp)
+{
+    if (cmp < 0)
+    {
+        (void)memcpy(search.best, row, sizeof(search.best));
+        beam_next.clear();
+    }
+
+    if (beam_next.size() >= canon_beam_limit)
+    {
+        search.overflow = true;
+        return;
+    }
+
+    beam_next.push_back(state);
+}
+
+/**
+ * @brief Extends a state by every admissible row at a canonical position, keeping the smallest rows.
+ */
+static void CanonExtend(CanonSearch &search, const CanonState &current, unsigned int pos)
+{
+    unsigned int used_rows = 0;
+    unsigned int used_bands = 0;
+
+    for (unsigned int i = 0; i < pos; i++)
+    {
+        used_rows |= 1u << current.rows[i];
+        used_bands |= 1u << (current.rows[i] / NUM_SUBGRID_ROWS);
+    }
+
+    for (unsigned int row = 0; row < NUM_ROWS; row++)
+    {
+        unsigned int band = row / NUM_SUBGRID_ROWS;
+
+        if (used_rows & (1u << row))
+        {
+            continue;
+        }
+        else if ((0 == (pos % NUM_SUBGRID_ROWS)) ? (used_bands & (1u << band)) : (band != current.rows[pos - 1] / NUM_SUBGRID_ROWS))
+        {
+            continue; /* Bands are either new or continued */
+        }
+        else if (!CanonIsNextByClues(search.clues[current.transpose], search.band_clues[current.transpose], used_rows, row))
+        {
+            continue;
+        }
+
+        CanonState state = current;
+        uint8_t labels[NUM_COLS];
+        int cmp = 0;
+        unsigned int col = 0;
+
+        state.rows[pos] = (uint8_t)row;
+
+        for (col = 0; col < NUM_COLS; col++)
+        {
+            uint8_t digit = search.grid[state.transpose][row][state.cols[col]];
+
+            if ((0 != digit) && (0 == state.label[digit]))
+            {
+                state.label[digit] = ++state.n_labels;
+            }
+
+            labels[col] = state.label[digit];
+
+            if (0 == cmp)
+            {
+                if (labels[col] > search.best[col])
+                {
+                    break;
+                }
+                cmp = (labels[col] < search.best[col]) ? -1 : 0;
+            }
+        }
+
+        if (NUM_COLS == col)
+        {
+            CanonPush(search, state, labels, cmp);
+
+            if (search.overflow)
+            {
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Extends every state of the current beam by one canonical row, keeping the smallest rows.
+ */
+static void CanonNextRow(CanonSearch &search, unsigned int pos)
+{
+    (void)memset(search.best, 0xFF, sizeof(search.best));
+    beam_next.clear();
+
+    for (const auto &current : beam_current)
+    {
+        CanonExtend(search, current, pos);
+
+        if (search.overflow)
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Depth-first search over the column orders of the first canonical row.
+ *
+ * Columns are placed left to right, respecting the stack structure, and branches whose prefix is
+ * already larger than the best first row are pruned. Complete first rows are extended by the
+ * second row right away, so the beam only holds the states tied on both rows; on dense grids most
+ * column orders tie on the first row alone.
+ */
+static void CanonFirstRow(CanonSearch &search, CanonState &state, unsigned int pos, unsigned int used_cols)
+{
+    if (search.overflow)
+    {
+        return;
+    }
+
+    if (NUM_COLS == pos)
+    {
+        if (memcmp(search.prefix, search.first, NUM_COLS) < 0)
+        {
+            (void)memcpy(search.first, search.prefix, sizeof(search.first));
+            (void)memset(search.best, 0xFF, sizeof(search.best));
+            beam_next.clear();
+        }
+
+        CanonExtend(search, state, 1);
+        return;
+    }
+
+    const uint8_t row = state.rows[0];
+    unsigned int first_stack = 0;
+    unsigned int last_stack = NUM_SUBGRID_COLS - 1;
+
+    if (0 != (pos % NUM_SUBGRID_COLS))
+    {
+        /* Continue the stack started by the previous column */
+        first_stack = last_stack = state.cols[pos - 1] / NUM_SUBGRID_COLS;
+    }
+
+    for (unsigned int stack = first_stack; stack <= last_stack; stack++)
+    {
+        if ((0 == (pos % NUM_SUBGRID_COLS)) && (used_cols & (0x7u << (NUM_SUBGRID_COLS * stack))))
+        {
+            continue; /* Stack already placed */
+        }
+
+        for (unsigned int col = NUM_SUBGRID_COLS * stack; col < NUM_SUBGRID_COLS * (stack + 1); col++)
+        {
+            if (used_cols & (1u << col))
+            {
+                continue;
+            }
+            else if (!CanonIsNextByClues(search.clues[!state.transpose], search.band_clues[!state.transpose], used_cols, col))
+            {
+                continue;
+            }
+
+            uint8_t digit = search.grid[state.transpose][row][col];
+            bool new_label = (0 != digit) && (0 == state.label[digit]);
+
+            if (new_label)
+            {
+                state.label[digit] = ++state.n_labels;
+            }
+
+            search.prefix[pos] = state.label[digit];
+
+            if (memcmp(search.prefix, search.first, pos + 1) <= 0)
+            {
+                state.cols[pos] = (uint8_t)col;
+                CanonFirstRow(search, state, pos + 1, used_cols | (1u << col));
+            }
+
+            if (new_label)
+            {
+                state.label[digit] = 0;
+                state.n_labels--;
+            }
+        }
+    }
+}
+
+Sudoku_RC_T Sudoku_Canonicalize(const struct SudokuPuzzle_S *p, SudokuGridKey &key, SudokuTransform &transform)
+{
+    CanonSearch search;
+    int8_t values[NUM_ROWS * NUM_COLS];
+    unsigned int n_clues = 0;
+
+    if (SUDOKU_RC_SUCCESS != Sudoku_GetValues(p, values))
+    {
+        return SUDOKU_RC_NULL_POINTER;
+    }
+
+    (void)memset(search.clues, 0, sizeof(search.clues));
+    (void)memset(search.band_clues, 0, sizeof(search.band_clues));
+
+    for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+    {
+        for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+        {
+            int val = values[row * NUM_COLS + col];
+            uint8_t digit = (val > 0 && val <= NUM_CANDIDATES) ? (uint8_t)val : 0;
+
+            search.grid[0][row][col] = digit;
+            search.grid[1][col][row] = digit;
+
+            if (0 != digit)
+            {
+                n_clues++;
+                search.clues[0][row]++;
+                search.clues[1][col]++;
+                search.band_clues[0][row / NUM_SUBGRID_ROWS]++;
+                search.band_clues[1][col / NUM_SUBGRID_COLS]++;
+            }
+        }
+    }
+
+    if (n_clues < canon_min_clues)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    /* Orientations: the rows must not have a larger sorted band and row clue profile than the columns */
+    uint8_t profile[2][NUM_SUBGRID_ROWS + NUM_ROWS];
+
+    for (unsigned int transpose = 0; transpose < 2; transpose++)
+    {
+        (void)memcpy(&profile[transpose][0], search.band_clues[transpose], NUM_SUBGRID_ROWS);
+        (void)memcpy(&profile[transpose][NUM_SUBGRID_ROWS], search.clues[transpose], NUM_ROWS);
+        std::sort(&profile[transpose][0], &profile[transpose][NUM_SUBGRID_ROWS]);
+        std::sort(&profile[transpose][NUM_SUBGRID_ROWS], &profile[transpose][NUM_SUBGRID_ROWS + NUM_ROWS]);
+    }
+
+    const int orientation = memcmp(profile[0], profile[1], sizeof(profile[0]));
+
+    /* First two canonical rows: every admissible orientation, row and column order */
+    (void)memset(search.first, 0xFF, sizeof(search.first));
+    (void)memset(search.best, 0xFF, sizeof(search.best));
+    search.overflow = false;
+    beam_next.clear();
+
+    for (uint8_t transpose = 0; transpose < 2; transpose++)
+    {
+        if ((0 == transpose) ? (orientation > 0) : (orientation < 0))
+        {
+            continue;
+        }
+
+        for (uint8_t row = 0; row < NUM_ROWS; row++)
+        {
+            if (!CanonIsNextByClues(search.clues[transpose], search.band_clues[transpose], 0, row))
+            {
+                continue;
+            }
+
+            CanonState state;
+            (void)memset(&state, 0, sizeof(state));
+            state.transpose = transpose;
+            state.rows[0] = row;
+
+            CanonFirstRow(search, state, 0, 0);
+        }
+    }
+
+    (void)memcpy(&key[0], search.first, NUM_COLS);
+    (void)memcpy(&key[NUM_COLS], search.best, NUM_COLS);
+
+    /* Remaining canonical rows */
+    for (unsigned int pos = 2; (pos < NUM_ROWS) && !search.overflow; pos++)
+    {
+        beam_current.swap(beam_next);
+        CanonNextRow(search, pos);
+        (void)memcpy(&key[pos * NUM_COLS], search.best, NUM_COLS);
+    }
+
+    if (search.overflow || beam_next.empty())
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    const CanonState &winner = beam_next.front();
+
+    transform.transpose = (0 != winner.transpose);
+    (void)memcpy(transform.rows, winner.rows, sizeof(transform.rows));
+    (void)memcpy(transform.cols, winner.cols, sizeof(transform.cols));
+    (void)memcpy(transform.digits, winner.label, sizeof(transform.digits));
+
+    /* Digits missing from the puzzle get the remaining labels in ascending order */
+    uint8_t n_labels = winner.n_labels;
+    for (unsigned int digit = 1; digit <= NUM_CANDIDATES; digit++)
+    {
+        if (0 == transform.digits[digit])
+        {
+            transform.digits[digit] = ++n_labels;
+        }
+    }
+
+    for (auto &c : key)
+    {
+        c = (char)('0' + c);
+    }
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+/**
+ * @brief Original row and column of a canonical cell.
+ */
+static void CanonCell(const SudokuTransform &transform, unsigned int i, unsigned int j, Sudoku_Row_Index_T &row, Sudoku_Column_Index_T &col)
+{
+    row = transform.transpose ? transform.cols[j] : transform.rows[i];
+    col = transform.transpose ? transform.rows[i] : transform.cols[j];
+}
+
+Sudoku_RC_T Sudoku_ApplyTransform(SudokuPuzzle_P p, const SudokuTransform &transform, SudokuGridKey &values)
+{
+    if (nullptr == p)
+    {
+        return SUDOKU_RC_NULL_POINTER;
+    }
+
+    for (unsigned int i = 0; i < NUM_ROWS; i++)
+    {
+        for (unsigned int j = 0; j < NUM_COLS; j++)
+        {
+            Sudoku_Row_Index_T row;
+            Sudoku_Column_Index_T col;
+            CanonCell(transform, i, j, row, col);
+
+            int val = Sudoku_GetValue(p, row, col);
+            values[i * NUM_COLS + j] = (char)('0' + ((val > 0 && val <= NUM_CANDIDATES) ? transform.digits[val] : 0));
+        }
+    }
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_RC_T Sudoku_ApplyInverseTransform(const SudokuGridKey &values, const SudokuTransform &transform, SudokuPuzzle_P p)
+{
+    uint8_t original[NUM_CANDIDATES + 1] = {0};
+
+    if (nullptr == p)
+    {
+        return SUDOKU_RC_NULL_POINTER;
+    }
+
+    for (unsigned int digit = 1; digit <= NUM_CANDIDATES; digit++)
+    {
+        original[transform.digits[digit]] = (uint8_t)digit;
+    }
+
+    for (unsigned int i = 0; i < NUM_ROWS; i++)
+    {
+        for (unsigned int j = 0; j < NUM_COLS; j++)
+        {
+            Sudoku_Row_Index_T row;
+            Sudoku_Column_Index_T col;
+            CanonCell(transform, i, j, row, col);
+
+            unsigned int val = (unsigned int)(values[i * NUM_COLS + j] - '0');
+            (void)Sudoku_SetValue(p, row, col, (val <= NUM_CANDIDATES) ? original[val] : 0);
+        }
+    }
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+size_t SudokuSolutionCache::KeyHash::operator()(const SudokuGridKey &key) const
+{
+    /* FNV-1a */
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : key)
+    {
+        hash = (hash ^ (uint8_t)c) * 0x100000001b3ull;
+    }
+    return (size_t)(hash ^ (hash >> 32));
+}
+
+SudokuSolutionCache::SudokuSolutionCache(size_t capacity, size_t n_shards)
+    : shard_capacity(0), hits(0), misses(0)
+{
+    n_shards = (n_shards > 0) ? n_shards : 1;
+    shard_capacity = (capacity + n_shards - 1) / n_shards;
+    shard_capacity = (shard_capacity > 0) ? shard_capacity : 1;
+
+    for (size_t i = 0; i < n_shards; i++)
+    {
+        shards.emplace_back(new Shard());
+    }
+}
+
+SudokuSolutionCache::Shard &SudokuSolutionCache::GetShard(const SudokuGridKey &key)
+{
+    /* Use other hash bits than the shard's hash table */
+    return *shards[(KeyHash()(key) >> 16) % shards.size()];
+}
+
+bool SudokuSolutionCache::Lookup(const SudokuGridKey &key, SudokuGridKey &solution)
+{
+    Shard &shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (shard.index.end() == it)
+    {
+        return false;
+    }
+
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    solution = it->second->solution;
+
+    return true;
+}
+
+void SudokuSolutionCache::Insert(const SudokuGridKey &key, const SudokuGridKey &solution)
+{
+    Shard &shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (shard.index.end() != it)
+    {
+        it->second->solution = solution;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+
+    if (shard.lru.size() >= shard_capacity)
+    {
+        /* Recycle the least recently used entry */
+        (void)shard.index.erase(shard.lru.back().key);
+        shard.lru.splice(shard.lru.begin(), shard.lru, std::prev(shard.lru.end()));
+        shard.lru.front().key = key;
+        shard.lru.front().solution = solution;
+    }
+    else
+    {
+        shard.lru.push_front(Entry{key, solution});
+    }
+
+    shard.index.emplace(key, shard.lru.begin());
+}
+
+void SudokuSolutionCache::Clear(void)
+{
+    for (auto &shard : shards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->index.clear();
+        shard->lru.clear();
+    }
+
+    hits = 0;
+    misses = 0;
+}
+
+size_t SudokuSolutionCache::Size(void) const
+{
+    size_t size = 0;
+
+    for (const auto &shard : shards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        size += shard->lru.size();
+    }
+
+    return size;
+}
+
+unsigned long SudokuSolutionCache::Hits(void) const
+{
+    return hits.load();
+}
+
+unsigned long SudokuSolutionCache::Misses(void) const
+{
+    return misses.load();
+}
+
+Sudoku_RC_T SudokuSolutionCache::Canonicalize(const SudokuPuzzle &puzzle, SudokuGridKey &key, SudokuTransform &transform)
+{
+    return Sudoku_Canonicalize(&puzzle.puzzle, key, transform);
+}
+
+Sudoku_RC_T SudokuSolutionCache::Solve(SudokuPuzzle &puzzle, Sudoku_Engine_T engine)
+{
+    SudokuGridKey key;
+    SudokuGridKey solution;
+    SudokuTransform transform;
+
+    if (SUDOKU_RC_SUCCESS != Sudoku_Canonicalize(&puzzle.puzzle, key, transform))
+    {
+        return puzzle.Solve(engine);
+    }
+
+    if (Lookup(key, solution))
+    {
+        hits++;
+        return Sudoku_ApplyInverseTransform(solution, transform, &puzzle.puzzle);
+    }
+
+    misses++;
+
+    auto rc = puzzle.Solve(engine);
+
+    if (SUDOKU_RC_SUCCESS == rc)
+    {
+        (void)Sudoku_ApplyTransform(&puzzle.puzzle, transform, solution);
+        Insert(key, solution);
+    }
+
+    return rc;
+}
@@ -0,0 +1,245 @@
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "_sudoku.h"
+#include "sudoku_dataset.h"
+
+    static const uint8_t dataset_magic[8] = {'S', 'U', 'D', 'O', 'K', 'U', 'D', 'S'};
+
+    static void datasetPutLE(uint8_t *dst, uint64_t value, unsigned int n)
+    {
+        for (unsigned int i = 0; i < n; i++)
+        {
+            dst[i] = (uint8_t)(value >> (8 * i));
+        }
+    }
+
+    static uint64_t datasetGetLE(const uint8_t *src, unsigned int n)
+    {
+        uint64_t value = 0;
+
+        for (unsigned int i = 0; i < n; i++)
+        {
+            value |= (uint64_t)src[i] << (8 * i);
+        }
+        return value;
+    }
+
+    static unsigned int datasetArrayValue(const char *array, unsigned int cell)
+    {
+        char c = array[cell];
+        return ((c >= '1') && (c <= '9')) ? (unsigned int)(c - '0') : 0;
+    }
+
+    static void datasetEncodeNibbles(uint8_t *dst, const char *array)
+    {
+        (void)memset(dst, 0, SUDOKU_DATASET_NIBBLES_SIZE);
+
+        for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+        {
+            dst[cell / 2] |= (uint8_t)(datasetArrayValue(array, cell) << (4 * (cell & 1)));
+        }
+    }
+
+    /**
+     * @brief Places the values of a nibble encoded grid into a puzzle.
+     */
+    static Sudoku_RC_T datasetDecodeNibbles(const uint8_t *src, SudokuPuzzle_P p)
+    {
+        for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+        {
+            unsigned int val = (src[cell / 2] >> (4 * (cell & 1))) & 0x0F;
+
+            if (val > NUM_CANDIDATES)
+            {
+                return SUDOKU_RC_INVALID_VALUE;
+            }
+            else if (val > 0)
+            {
+                (void)Sudoku_SetValue(p, cell / NUM_COLS, cell % NUM_COLS, (int)val);
+            }
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    size_t Sudoku_Dataset_RecordSize(uint32_t flags, unsigned int max_givens)
+    {
+        size_t size = (flags & SUDOKU_DATASET_FLAG_GIVENS) ? (SUDOKU_DATASET_GIVENS_MASK_SIZE + (max_givens + 1) / 2)
+                                                          : SUDOKU_DATASET_NIBBLES_SIZE;
+
+        return size + ((flags & SUDOKU_DATASET_FLAG_SOLUTION) ? SUDOKU_DATASET_NIBBLES_SIZE : 0);
+    }
+
+    Sudoku_RC_T Sudoku_Dataset_WriteHeader(uint8_t *header, uint32_t flags, uint64_t count, unsigned int max_givens)
+    {
+        if (NULL == header)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+        else if (max_givens > NUM_ROWS * NUM_COLS || (flags & ~(SUDOKU_DATASET_FLAG_GIVENS | SUDOKU_DATASET_FLAG_SOLUTION)))
+        {
+            return SUDOKU_RC_INVALID_INPUT;
+        }
+
+        (void)memset(header, 0, SUDOKU_DATASET_HEADER_SIZE);
+        (void)memcpy(header, dataset_magic, sizeof(dataset_magic));
+        datasetPutLE(&header[8], SUDOKU_DATASET_VERSION, 4);
+        datasetPutLE(&header[12], flags, 4);
+        datasetPutLE(&header[16], count, 8);
+        datasetPutLE(&header[24], Sudoku_Dataset_RecordSize(flags, max_givens), 4);
+        header[28] = (uint8_t)max_givens;
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_RC_T Sudoku_Dataset_EncodeRecord(const Sudoku_Dataset_T *dataset, uint8_t *record, const char *puzzle, const char *solution)
+    {
+        if (NULL == dataset || NULL == record || NULL == puzzle)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        (void)memset(record, 0, dataset->record_size);
+
+        uint8_t *solution_record = record;
+
+        if (dataset->flags & SUDOKU_DATASET_FLAG_GIVENS)
+        {
+            unsigned int n_givens = 0;
+
+            for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+            {
+                unsigned int val = datasetArrayValue(puzzle, cell);
+
+                if (0 == val)
+                {
+                    continue;
+                }
+                else if (n_givens >= dataset->max_givens)
+                {
+                    return SUDOKU_RC_INVALID_INPUT;
+                }
+
+                record[cell / 8] |= (uint8_t)(1u << (cell % 8));
+                record[SUDOKU_DATASET_GIVENS_MASK_SIZE + n_givens / 2] |= (uint8_t)(val << (4 * (n_givens & 1)));
+                n_givens++;
+            }
+
+            solution_record += SUDOKU_DATASET_GIVENS_MASK_SIZE + (dataset->max_givens + 1) / 2;
+        }
+        else
+        {
+            datasetEncodeNibbles(record, puzzle);
+            solution_record += SUDOKU_DATASET_NIBBLES_SIZE;
+        }
+
+        if ((dataset->flags & SUDOKU_DATASET_FLAG_SOLUTION) && (NULL != solution))
+        {
+            datasetEncodeNibbles(solution_record, solution);
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_RC_T Sudoku_Dataset_Open(Sudoku_Dataset_T *dataset, const void *data, size_t size)
+    {
+        const uint8_t *header = (const uint8_t *)data;
+
+        if (NULL == dataset || NULL == data)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+        else if (size < SUDOKU_DATASET_HEADER_SIZE || 0 != memcmp(header, dataset_magic, sizeof(dataset_magic)) ||
+                 SUDOKU_DATASET_VERSION != datasetGetLE(&header[8], 4))
+        {
+            return SUDOKU_RC_INVALID_INPUT;
+        }
+
+        dataset->flags = (uint32_t)datasetGetLE(&header[12], 4);
+        dataset->count = datasetGetLE(&header[16], 8);
+        dataset->record_size = (uint32_t)datasetGetLE(&header[24], 4);
+        dataset->max_givens = header[28];
+        dataset->records = header + SUDOKU_DATASET_HEADER_SIZE;
+
+        if (dataset->max_givens > NUM_ROWS * NUM_COLS ||
+            dataset->record_size != Sudoku_Dataset_RecordSize(dataset->flags, dataset->max_givens) ||
+            dataset->count > (size - SUDOKU_DATASET_HEADER_SIZE) / dataset->record_size)
+        {
+            return SUDOKU_RC_INVALID_INPUT;
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    Sudoku_RC_T Sudoku_Dataset_Read(const Sudoku_Dataset_T *dataset, uint64_t index, SudokuPuzzle_P puzzle, SudokuPuzzle_P solution)
+    {
+        if (NULL == dataset || NULL == puzzle)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+        else if (index >= dataset->count || (NULL != solution && !(dataset->flags & SUDOKU_DATASET_FLAG_SOLUTION)))
+        {
+            return SUDOKU_RC_INVALID_INPUT;
+        }
+
+        const uint8_t *record = dataset->records + index * dataset->record_size;
+        const uint8_t *solution_record = record;
+        Sudoku_RC_T rc = Sudoku_InitializePuzzle(puzzle);
+
+        if (dataset->flags & SUDOKU_DATASET_FLAG_GIVENS)
+        {
+            const uint8_t *values = record + SUDOKU_DATASET_GIVENS_MASK_SIZE;
+            unsigned int n_givens = 0;
+
+            for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS && SUDOKU_RC_SUCCESS == rc; cell++)
+            {
+                if (0 == (record[cell / 8] & (1u << (cell % 8))))
+                {
+                    continue;
+                }
+
+                unsigned int val = (n_givens < dataset->max_givens) ? ((values[n_givens / 2] >> (4 * (n_givens & 1))) & 0x0F) : 0;
+
+                if (0 == val || val > NUM_CANDIDATES)
+                {
+                    rc = SUDOKU_RC_INVALID_VALUE;
+                }
+                else
+                {
+                    (void)Sudoku_SetValue(puzzle, cell / NUM_COLS, cell % NUM_COLS, (int)val);
+                    n_givens++;
+                }
+            }
+
+            solution_record += SUDOKU_DATASET_GIVENS_MASK_SIZE + (dataset->max_givens + 1) / 2;
+        }
+        else
+        {
+            rc = datasetDecodeNibbles(record, puzzle);
+            solution_record += SUDOKU_DATASET_NIBBLES_SIZE;
+        }
+
+        if (SUDOKU_RC_SUCCESS == rc && NULL != solution)
+        {
+            rc = Sudoku_InitializePuzzle(solution);
+
+            if (SUDOKU_RC_SUCCESS == rc)
+            {
+                rc = datasetDecodeNibbles(solution_record, solution);
+            }
+
+            if (SUDOKU_RC_SUCCESS == rc && 0 == solution_record[0])
+            {
+                rc = SUDOKU_RC_NOT_SOLVABLE; /* The first cell of a known solution is never empty */
+            }
+        }
+
+        return rc;
+    }
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,258 @@
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "_sudoku.h"
+#include "_sudoku_dlx.h"
+
+#define DLX_ROOT 0
+#define DLX_CELL_COLUMN(row, col, val) (1 + (row) * NUM_COLS + (col))
+#define DLX_ROW_COLUMN(row, col, val) (1 + 81 + (row) * NUM_CANDIDATES + (val))
+#define DLX_COL_COLUMN(row, col, val) (1 + 162 + (col) * NUM_CANDIDATES + (val))
+#define DLX_SUB_COLUMN(row, col, val) (1 + 243 + (3 * ((row) / 3) + (col) / 3) * NUM_CANDIDATES + (val))
+#define DLX_PLACEMENT(row, col, val) (((row) * NUM_COLS + (col)) * NUM_CANDIDATES + (val))
+
+    /**
+     * @brief Links the root and the column headers into an empty matrix.
+     */
+    static void dlxReset(struct SudokuDLX_S *dlx)
+    {
+        for (Sudoku_DLX_Index_T c = 0; c <= SUDOKU_DLX_COLUMNS; c++)
+        {
+            dlx->left[c] = (c == DLX_ROOT) ? SUDOKU_DLX_COLUMNS : c - 1;
+            dlx->right[c] = (c == SUDOKU_DLX_COLUMNS) ? DLX_ROOT : c + 1;
+            dlx->up[c] = c;
+            dlx->down[c] = c;
+            dlx->column[c] = c;
+            dlx->size[c] = 0;
+        }
+
+        dlx->n_nodes = 1 + SUDOKU_DLX_COLUMNS;
+        dlx->n_partial = 0;
+        dlx->n_solutions = 0;
+        dlx->n_nodes_visited = 0;
+        dlx->max_level = 0;
+    }
+
+    /**
+     * @brief Appends the four constraint nodes of a placement to the matrix.
+     */
+    static void dlxAddPlacement(struct SudokuDLX_S *dlx, Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, unsigned int val)
+    {
+        const Sudoku_DLX_Index_T columns[4] = {
+            (Sudoku_DLX_Index_T)DLX_CELL_COLUMN(row, col, val),
+            (Sudoku_DLX_Index_T)DLX_ROW_COLUMN(row, col, val),
+            (Sudoku_DLX_Index_T)DLX_COL_COLUMN(row, col, val),
+            (Sudoku_DLX_Index_T)DLX_SUB_COLUMN(row, col, val)};
+        Sudoku_DLX_Index_T first = dlx->n_nodes;
+
+        for (unsigned int k = 0; k < 4; k++)
+        {
+            Sudoku_DLX_Index_T n = dlx->n_nodes++;
+            Sudoku_DLX_Index_T c = columns[k];
+
+            dlx->column[n] = c;
+            dlx->row[n] = (Sudoku_DLX_Index_T)DLX_PLACEMENT(row, col, val);
+            dlx->up[n] = dlx->up[c];
+            dlx->down[n] = c;
+            dlx->down[dlx->up[c]] = n;
+            dlx->up[c] = n;
+            dlx->size[c]++;
+
+            dlx->left[n] = (k == 0) ? first + 3 : n - 1;
+            dlx->right[n] = (k == 3) ? first : n + 1;
+        }
+    }
+
+    static void dlxCover(struct SudokuDLX_S *dlx, Sudoku_DLX_Index_T c)
+    {
+        dlx->right[dlx->left[c]] = dlx->right[c];
+        dlx->left[dlx->right[c]] = dlx->left[c];
+
+        for (Sudoku_DLX_Index_T i = dlx->down[c]; i != c; i = dlx->down[i])
+        {
+            for (Sudoku_DLX_Index_T j = dlx->right[i]; j != i; j = dlx->right[j])
+            {
+                dlx->up[dlx->down[j]] = dlx->up[j];
+                dlx->down[dlx->up[j]] = dlx->down[j];
+                dlx->size[dlx->column[j]]--;
+            }
+        }
+    }
+
+    static void dlxUncover(struct SudokuDLX_S *dlx, Sudoku_DLX_Index_T c)
+    {
+        for (Sudoku_DLX_Index_T i = dlx->up[c]; i != c; i = dlx->up[i])
+        {
+            for (Sudoku_DLX_Index_T j = dlx->left[i]; j != i; j = dlx->left[j])
+            {
+                dlx->size[dlx->column[j]]++;
+                dlx->up[dlx->down[j]] = j;
+                dlx->down[dlx->up[j]] = j;
+            }
+        }
+
+        dlx->right[dlx->left[c]] = c;
+        dlx->left[dlx->right[c]] = c;
+    }
+
+    /**
+     * @brief Recursive Algorithm X search, branching on the column with the fewest rows.
+     */
+    static void dlxSearch(struct SudokuDLX_S *dlx, unsigned int level)
+    {
+        dlx->n_nodes_visited++;
+        dlx->max_level = (level > dlx->max_level) ? level : dlx->max_level;
+
+        if (dlx->right[DLX_ROOT] == DLX_ROOT)
+        {
+            if (0 == dlx->n_solutions)
+            {
+                (void)memcpy(dlx->solution, dlx->partial, sizeof(dlx->solution));
+            }
+            else if (1 == dlx->n_solutions)
+            {
+                (void)memcpy(dlx->second, dlx->partial, sizeof(dlx->second));
+            }
+            dlx->n_solutions++;
+            return;
+        }
+
+        Sudoku_DLX_Index_T best = dlx->right[DLX_ROOT];
+        for (Sudoku_DLX_Index_T c = dlx->right[best]; c != DLX_ROOT; c = dlx->right[c])
+        {
+            if (dlx->size[c] < dlx->size[best])
+            {
+                best = c;
+            }
+        }
+
+        if (0 == dlx->size[best])
+        {
+            return;
+        }
+
+        dlxCover(dlx, best);
+
+        for (Sudoku_DLX_Index_T r = dlx->down[best]; r != best && dlx->n_solutions < dlx->limit; r = dlx->down[r])
+        {
+            dlx->partial[dlx->n_partial++] = dlx->row[r];
+
+            for (Sudoku_DLX_Index_T j = dlx->right[r]; j != r; j = dlx->right[j])
+            {
+                dlxCover(dlx, dlx->column[j]);
+            }
+
+            dlxSearch(dlx, level + 1);
+
+            for (Sudoku_DLX_Index_T j = dlx->left[r]; j != r; j = dlx->left[j])
+            {
+                dlxUncover(dlx, dlx->column[j]);
+            }
+
+            dlx->n_partial--;
+        }
+
+        dlxUncover(dlx, best);
+    }
+
+    Sudoku_RC_T Sudoku_DLX_Solve(struct SudokuDLX_S *dlx, SudokuPuzzle_P p, unsigned long limit)
+    {
+        uint8_t covered[1 + SUDOKU_DLX_COLUMNS] = {0};
+
+        if (NULL == dlx || NULL == p)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        dlxReset(dlx);
+        dlx->limit = (limit > 0) ? limit : 1;
+
+        /* Build the matrix from the placements that are still allowed */
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                uint32_t value = p->grid[row][col].value;
+                uint32_t allowed = (SUDOKU_MASK_NONE == value) ? (p->grid[row][col].candidates & SUDOKU_MASK_ALL) : value;
+
+                if ((allowed & ~SUDOKU_MASK_ALL) || (value & (value - 1)))
+                {
+                    return SUDOKU_RC_ERROR; /* Invalid or non-exclusive cell value */
+                }
+
+                for (unsigned int val = 0; val < NUM_CANDIDATES; val++)
+                {
+                    if (allowed & ((uint32_t)1 << val))
+                    {
+                        dlxAddPlacement(dlx, row, col, val);
+                    }
+                }
+            }
+        }
+
+        /* Select the placements of the given values */
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                uint32_t value = p->grid[row][col].value;
+
+                if (SUDOKU_MASK_NONE == value)
+                {
+                    continue;
+                }
+
+                unsigned int val = (unsigned int)Sudoku_GetValue(p, row, col) - 1;
+                const Sudoku_DLX_Index_T columns[4] = {
+                    (Sudoku_DLX_Index_T)DLX_CELL_COLUMN(row, col, val),
+                    (Sudoku_DLX_Index_T)DLX_ROW_COLUMN(row, col, val),
+                    (Sudoku_DLX_Index_T)DLX_COL_COLUMN(row, col, val),
+                    (Sudoku_DLX_Index_T)DLX_SUB_COLUMN(row, col, val)};
+
+                for (unsigned int k = 0; k < 4; k++)
+                {
+                    if (covered[columns[k]])
+                    {
+                        return SUDOKU_RC_ERROR; /* Two givens share a constraint */
+                    }
+                    covered[columns[k]] = 1;
+                    dlxCover(dlx, columns[k]);
+                }
+
+                dlx->partial[dlx->n_partial++] = (Sudoku_DLX_Index_T)DLX_PLACEMENT(row, col, val);
+            }
+        }
+
+        dlxSearch(dlx, 0);
+
+        return (dlx->n_solutions > 0) ? SUDOKU_RC_SUCCESS : SUDOKU_RC_ERROR;
+    }
+
+    Sudoku_RC_T Sudoku_DLX_StoreSolution(const struct SudokuDLX_S *dlx, SudokuPuzzle_P p)
+    {
+        if (NULL == dlx || NULL == p)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+        else if (0 == dlx->n_solutions)
+        {
+            return SUDOKU_RC_ERROR;
+        }
+
+        for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+        {
+            Sudoku_DLX_Index_T placement = dlx->solution[i];
+            Sudoku_Row_Index_T row = placement / (NUM_COLS * NUM_CANDIDATES);
+            Sudoku_Column_Index_T col = (placement / NUM_CANDIDATES) % NUM_COLS;
+
+            (void)Sudoku_SetValue(p, row, col, (int)(placement % NUM_CANDIDATES) + 1);
+        }
+
+        return SUDOKU_RC_SUCCESS;
+    }
+
+#ifdef __cplusplus
+}
+#endif
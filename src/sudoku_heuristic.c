@@ -0,0 +1,118 @@
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "sudoku_heuristic.h"
+
+#include <string.h>
+
+    static uint32_t heuristicScoreWeighted(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, void *user)
+    {
+        (void)user;
+        return Sudoku_ScoreWeighted(sel, cell);
+    }
+
+    static uint32_t heuristicScoreMRV(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, void *user)
+    {
+        (void)user;
+        return Sudoku_ScoreMRV(sel, cell);
+    }
+
+    static uint32_t heuristicScoreUnit(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, void *user)
+    {
+        (void)user;
+        return Sudoku_ScoreUnit(sel, cell);
+    }
+
+    static uint32_t heuristicScoreEqualWeights(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, void *user)
+    {
+        (void)user;
+        return Sudoku_ScoreEqualWeights(sel, cell);
+    }
+
+    static uint32_t heuristicScoreBivalue(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, void *user)
+    {
+        (void)user;
+        return Sudoku_ScoreBivalue(sel, cell);
+    }
+
+    static uint32_t heuristicOrderLeastFrequent(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value, void *user)
+    {
+        (void)user;
+        return Sudoku_OrderLeastFrequent(sel, cell, value);
+    }
+
+    static uint32_t heuristicOrderMostFrequent(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value, void *user)
+    {
+        (void)user;
+        return Sudoku_OrderMostFrequent(sel, cell, value);
+    }
+
+    static uint32_t heuristicOrderAscending(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value, void *user)
+    {
+        (void)user;
+        return Sudoku_OrderAscending(sel, cell, value);
+    }
+
+    static uint32_t heuristicOrderLeastConstraining(const Sudoku_Selection_T *sel, const Sudoku_CellInfo_T *cell, unsigned int value, void *user)
+    {
+        (void)user;
+        return Sudoku_OrderLeastConstraining(sel, cell, value);
+    }
+
+    const Sudoku_Heuristic_T Sudoku_Heuristics[] = {
+        {"weighted", heuristicScoreWeighted, heuristicOrderLeastFrequent, NULL},
+        {"mrv", heuristicScoreMRV, heuristicOrderAscending, NULL},
+        {"unit", heuristicScoreUnit, heuristicOrderLeastFrequent, NULL},
+        {"bivalue", heuristicScoreBivalue, heuristicOrderLeastFrequent, NULL},
+        {"mrv-lcv", heuristicScoreMRV, heuristicOrderLeastConstraining, NULL},
+    };
+
+    const unsigned int Sudoku_NumHeuristics = sizeof(Sudoku_Heuristics) / sizeof(Sudoku_Heuristics[0]);
+
+    const Sudoku_ScoreFunction_T Sudoku_BranchScores[] = {
+        heuristicScoreWeighted,     /* SUDOKU_SCORE_WEIGHTED */
+        heuristicScoreMRV,          /* SUDOKU_SCORE_MRV */
+        heuristicScoreEqualWeights, /* SUDOKU_SCORE_UNITS */
+    };
+
+    const Sudoku_OrderFunction_T Sudoku_ValueOrders[] = {
+        heuristicOrderLeastFrequent, /* SUDOKU_ORDER_LEAST_FREQUENT */
+        heuristicOrderMostFrequent,  /* SUDOKU_ORDER_MOST_FREQUENT */
+        heuristicOrderAscending,     /* SUDOKU_ORDER_ASCENDING */
+    };
+
+    const Sudoku_Heuristic_T *Sudoku_FindHeuristic(const char *name)
+    {
+        if (NULL == name)
+        {
+            return NULL;
+        }
+
+        for (unsigned int i = 0; i < Sudoku_NumHeuristics; i++)
+        {
+            if (0 == strcmp(name, Sudoku_Heuristics[i].name))
+            {
+                return &Sudoku_Heuristics[i];
+            }
+        }
+
+        return NULL;
+    }
+
+    Sudoku_BitValues_T Sudoku_SelectCandidateUsingHeuristic(SudokuPuzzle_P p, const Sudoku_Heuristic_T *heuristic, Sudoku_Row_Index_T *row, Sudoku_Column_Index_T *col)
+    {
+        Sudoku_SearchConfig_T config = {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, &Sudoku_Heuristics[0]};
+
+        if (NULL != heuristic)
+        {
+            config.heuristic = heuristic;
+        }
+
+        return Sudoku_SelectCandidateUsingConfig(p, &config, NULL, row, col);
+    }
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "_sudoku_kernels.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SUDOKU_KERNELS_X86 1
+#include <immintrin.h>
+#else
+#define SUDOKU_KERNELS_X86 0
+#endif
+
+/* Compile-time population count table for all 9-bit candidate masks */
+#define SUDOKU_POPCNT_2(n) n, n + 1, n + 1, n + 2
+#define SUDOKU_POPCNT_4(n) SUDOKU_POPCNT_2(n), SUDOKU_POPCNT_2(n + 1), SUDOKU_POPCNT_2(n + 1), SUDOKU_POPCNT_2(n + 2)
+#define SUDOKU_POPCNT_6(n) SUDOKU_POPCNT_4(n), SUDOKU_POPCNT_4(n + 1), SUDOKU_POPCNT_4(n + 1), SUDOKU_POPCNT_4(n + 2)
+#define SUDOKU_POPCNT_8(n) SUDOKU_POPCNT_6(n), SUDOKU_POPCNT_6(n + 1), SUDOKU_POPCNT_6(n + 1), SUDOKU_POPCNT_6(n + 2)
+
+    static const uint8_t popcount_table[2 * 256] = {SUDOKU_POPCNT_8(0), SUDOKU_POPCNT_8(1)};
+
+    /* De Bruijn sequence lookup for the index of an isolated bit */
+    static const uint8_t debruijn_table[32] = {
+        0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9};
+
+    /**
+     * @brief Portable population count.
+     *
+     * Candidate masks use the lower 9 bits, which are resolved by a single table lookup.
+     * Wider masks (e.g. SUDOKU_MASK_INVALID) fall back to a SWAR reduction.
+     */
+    static unsigned int countPortable(uint32_t mask)
+    {
+        if (mask <= SUDOKU_MASK_ALL)
+        {
+            return popcount_table[mask];
+        }
+
+        mask = mask - ((mask >> 1) & 0x55555555u);
+        mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+        mask = (mask + (mask >> 4)) & 0x0F0F0F0Fu;
+        return (mask * 0x01010101u) >> 24;
+    }
+
+    static unsigned int lowestPortable(uint32_t mask)
+    {
+        return debruijn_table[((mask & (0u - mask)) * 0x077CB531u) >> 27];
+    }
+
+#if SUDOKU_KERNELS_X86
+    __attribute__((target("popcnt"))) static unsigned int countPopcnt(uint32_t mask)
+    {
+        return (unsigned int)__builtin_popcount(mask);
+    }
+
+    __attribute__((target("bmi"))) static unsigned int lowestTzcnt(uint32_t mask)
+    {
+        return (unsigned int)_tzcnt_u32(mask);
+    }
+#endif
+
+    struct SudokuKernels_S Sudoku_Kernels = {
+        SUDOKU_KERNEL_PORTABLE,
+        countPortable,
+        lowestPortable,
+    };
+
+    void Sudoku_SelectPortableKernels(void)
+    {
+        Sudoku_Kernels.features = SUDOKU_KERNEL_PORTABLE;
+        Sudoku_Kernels.count = countPortable;
+        Sudoku_Kernels.lowest = lowestPortable;
+    }
+
+#if SUDOKU_KERNELS_X86
+    __attribute__((constructor))
+#endif
+    void Sudoku_SelectKernels(void)
+    {
+        Sudoku_SelectPortableKernels();
+
+#if SUDOKU_KERNELS_X86
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("popcnt"))
+        {
+            Sudoku_Kernels.count = countPopcnt;
+            Sudoku_Kernels.features |= SUDOKU_KERNEL_POPCNT;
+        }
+
+        if (__builtin_cpu_supports("bmi"))
+        {
+            Sudoku_Kernels.lowest = lowestTzcnt;
+            Sudoku_Kernels.features |= SUDOKU_KERNEL_TZCNT;
+        }
+#endif
+    }
+
+#ifdef __cplusplus
+}
+#endif
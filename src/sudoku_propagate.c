@@ -0,0 +1,603 @@
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "_sudoku.h"
+#include "_sudoku_kernels.h"
+
+#include <string.h>
+
+#define SUDOKU_NUM_UNITS (NUM_ROWS + NUM_COLS + NUM_SUBGRID) /**< Rows 0-8, columns 9-17, subgrids 18-26. */
+
+    /**
+     * @brief Cells of each unit (row * 9 + column), in the numbering of the hints.
+     */
+    static const uint8_t propagationUnitCells[SUDOKU_NUM_UNITS][NUM_SUBGRID_ELEMENTS] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8},
+        {9, 10, 11, 12, 13, 14, 15, 16, 17},
+        {18, 19, 20, 21, 22, 23, 24, 25, 26},
+        {27, 28, 29, 30, 31, 32, 33, 34, 35},
+        {36, 37, 38, 39, 40, 41, 42, 43, 44},
+        {45, 46, 47, 48, 49, 50, 51, 52, 53},
+        {54, 55, 56, 57, 58, 59, 60, 61, 62},
+        {63, 64, 65, 66, 67, 68, 69, 70, 71},
+        {72, 73, 74, 75, 76, 77, 78, 79, 80},
+        {0, 9, 18, 27, 36, 45, 54, 63, 72},
+        {1, 10, 19, 28, 37, 46, 55, 64, 73},
+        {2, 11, 20, 29, 38, 47, 56, 65, 74},
+        {3, 12, 21, 30, 39, 48, 57, 66, 75},
+        {4, 13, 22, 31, 40, 49, 58, 67, 76},
+        {5, 14, 23, 32, 41, 50, 59, 68, 77},
+        {6, 15, 24, 33, 42, 51, 60, 69, 78},
+        {7, 16, 25, 34, 43, 52, 61, 70, 79},
+        {8, 17, 26, 35, 44, 53, 62, 71, 80},
+        {0, 1, 2, 9, 10, 11, 18, 19, 20},
+        {3, 4, 5, 12, 13, 14, 21, 22, 23},
+        {6, 7, 8, 15, 16, 17, 24, 25, 26},
+        {27, 28, 29, 36, 37, 38, 45, 46, 47},
+        {30, 31, 32, 39, 40, 41, 48, 49, 50},
+        {33, 34, 35, 42, 43, 44, 51, 52, 53},
+        {54, 55, 56, 63, 64, 65, 72, 73, 74},
+        {57, 58, 59, 66, 67, 68, 75, 76, 77},
+        {60, 61, 62, 69, 70, 71, 78, 79, 80},
+    };
+
+#define SUDOKU_PLANE_SEGMENT 0x007u /**< Positions 0-2 of a line, or the first row of a subgrid. */
+#define SUDOKU_PLANE_STRIPE 0x049u  /**< Positions 0, 3 and 6: the first column of a subgrid. */
+
+    /**
+     * @brief Candidate positions of every value in every unit.
+     *
+     * Bit k of place[v][u] is set if the k-th cell of unit u may hold value v + 1. The planes of a
+     * row and of a column are the column and the row indexes of the cells, so a set of lines of
+     * one orientation is also a set of positions in the lines of the other one.
+     */
+    struct SudokuPlanes_S
+    {
+        uint32_t place[NUM_CANDIDATES][SUDOKU_NUM_UNITS]; /**< Positions of each value in each unit. */
+        uint32_t missing[SUDOKU_NUM_UNITS];               /**< Values not placed in each unit. */
+    };
+
+    /**
+     * @brief Candidate mask of a cell.
+     */
+    static inline uint32_t *cellCandidates(SudokuPuzzle_P p, unsigned int cell)
+    {
+        return &p->grid[cell / NUM_COLS][cell % NUM_COLS].candidates;
+    }
+
+    /**
+     * @brief Builds the planes of a pruned puzzle.
+     */
+    static void buildPlanes(SudokuPuzzle_P p, struct SudokuPlanes_S *planes)
+    {
+        (void)memset(planes->place, 0, sizeof(planes->place));
+
+        for (unsigned int row = 0; row < NUM_ROWS; row++)
+        {
+            for (unsigned int col = 0; col < NUM_COLS; col++)
+            {
+                unsigned int sub = 3 * (row / 3) + col / 3;
+                uint32_t sub_position = 1u << (3 * (row % 3) + col % 3);
+
+                for (uint32_t cand = p->grid[row][col].candidates & SUDOKU_MASK_ALL; cand != 0; cand &= cand - 1)
+                {
+                    unsigned int val = Sudoku_Kernels.lowest(cand);
+
+                    planes->place[val][row] |= 1u << col;
+                    planes->place[val][NUM_ROWS + col] |= 1u << row;
+                    planes->place[val][NUM_ROWS + NUM_COLS + sub] |= sub_position;
+                }
+            }
+
+            planes->missing[row] = p->row_candidates[row];
+            planes->missing[NUM_ROWS + row] = p->col_candidates[row];
+            planes->missing[NUM_ROWS + NUM_COLS + row] = p->sub_candidates[row / 3][row % 3];
+        }
+    }
+
+    /**
+     * @brief Removes candidates from the cells at some positions of a unit.
+     *
+     * The planes may hold candidates removed earlier in the same round. Deductions drawn from more
+     * candidates than there are are still sound, and removals only ever narrow the masks.
+     *
+     * @return Number of candidates removed.
+     */
+    static unsigned int removeFromCells(SudokuPuzzle_P p, unsigned int unit, uint32_t positions, uint32_t values)
+    {
+        unsigned int n = 0;
+
+        for (; positions != 0; positions &= positions - 1)
+        {
+            uint32_t *cand = cellCandidates(p, propagationUnitCells[unit][Sudoku_Kernels.lowest(positions)]);
+
+            n += Sudoku_KernelCount(*cand & values);
+            *cand &= ~values;
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Places the values confined to one cell of a unit.
+     *
+     * @return Number of hidden singles, or -1 if a missing value has no place left in a unit.
+     */
+    static int findHiddenSingles(SudokuPuzzle_P p, const struct SudokuPlanes_S *planes)
+    {
+        int n = 0;
+
+        for (unsigned int unit = 0; unit < SUDOKU_NUM_UNITS; unit++)
+        {
+            for (uint32_t missing = planes->missing[unit]; missing != 0; missing &= missing - 1)
+            {
+                unsigned int val = Sudoku_Kernels.lowest(missing);
+                uint32_t positions = planes->place[val][unit];
+
+                if (0 == positions)
+                {
+                    return -1;
+                }
+                else if (0 == (positions & (positions - 1)))
+                {
+                    uint32_t *cand = cellCandidates(p, propagationUnitCells[unit][Sudoku_Kernels.lowest(positions)]);
+
+                    if ((1u << val) != *cand)
+                    {
+                        *cand &= 1u << val;
+                        n++;
+                    }
+                }
+            }
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Pointing (a value of a subgrid confined to one line) and claiming (a value of a line
+     *        confined to one subgrid).
+     *
+     * @return Number of candidates removed.
+     */
+    static unsigned int findLockedCandidates(SudokuPuzzle_P p, const struct SudokuPlanes_S *planes)
+    {
+        unsigned int n = 0;
+
+        for (unsigned int val = 0; val < NUM_CANDIDATES; val++)
+        {
+            const uint32_t *place = planes->place[val];
+
+            for (unsigned int sub = 0; sub < NUM_SUBGRID; sub++)
+            {
+                uint32_t positions = place[NUM_ROWS + NUM_COLS + sub];
+
+                for (unsigned int k = 0; (k < 3) && (0 != positions); k++)
+                {
+                    unsigned int row = 3 * (sub / 3) + k;
+                    unsigned int col = 3 * (sub % 3) + k;
+
+                    if (0 == (positions & ~(SUDOKU_PLANE_SEGMENT << (3 * k))))
+                    {
+                        n += removeFromCells(p, row, place[row] & ~(SUDOKU_PLANE_SEGMENT << (3 * (sub % 3))), 1u << val);
+                    }
+                    if (0 == (positions & ~(SUDOKU_PLANE_STRIPE << k)))
+                    {
+                        n += removeFromCells(p, NUM_ROWS + col, place[NUM_ROWS + col] & ~(SUDOKU_PLANE_SEGMENT << (3 * (sub / 3))), 1u << val);
+                    }
+                }
+            }
+
+            for (unsigned int line = 0; line < NUM_ROWS; line++)
+            {
+                uint32_t row_positions = place[line];
+                uint32_t col_positions = place[NUM_ROWS + line];
+
+                for (unsigned int k = 0; k < 3; k++)
+                {
+                    if ((0 != row_positions) && (0 == (row_positions & ~(SUDOKU_PLANE_SEGMENT << (3 * k)))))
+                    {
+                        unsigned int sub = 3 * (line / 3) + k;
+                        n += removeFromCells(p, NUM_ROWS + NUM_COLS + sub, place[NUM_ROWS + NUM_COLS + sub] & ~(SUDOKU_PLANE_SEGMENT << (3 * (line % 3))), 1u << val);
+                    }
+                    if ((0 != col_positions) && (0 == (col_positions & ~(SUDOKU_PLANE_SEGMENT << (3 * k)))))
+                    {
+                        unsigned int sub = 3 * k + line / 3;
+                        n += removeFromCells(p, NUM_ROWS + NUM_COLS + sub, place[NUM_ROWS + NUM_COLS + sub] & ~(SUDOKU_PLANE_STRIPE << (line % 3)), 1u << val);
+                    }
+                }
+            }
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Naked pairs and triples: n cells of a unit whose candidates are n values.
+     *
+     * @return Number of candidates removed.
+     */
+    static unsigned int findNakedSubsets(SudokuPuzzle_P p)
+    {
+        unsigned int n = 0;
+
+        for (unsigned int unit = 0; unit < SUDOKU_NUM_UNITS; unit++)
+        {
+            uint32_t cands[NUM_SUBGRID_ELEMENTS];
+            uint8_t small[NUM_SUBGRID_ELEMENTS];
+            unsigned int n_small = 0;
+            uint32_t open = 0;
+
+            for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+            {
+                unsigned int count;
+
+                cands[k] = *cellCandidates(p, propagationUnitCells[unit][k]) & SUDOKU_MASK_ALL;
+                count = Sudoku_KernelCount(cands[k]);
+                open |= (0 != count) ? (1u << k) : 0;
+                if ((2 <= count) && (count <= 3))
+                {
+                    small[n_small++] = (uint8_t)k;
+                }
+            }
+
+            if (Sudoku_KernelCount(open) <= 2)
+            {
+                continue;
+            }
+
+            for (unsigned int i = 0; i < n_small; i++)
+            {
+                for (unsigned int j = i + 1; j < n_small; j++)
+                {
+                    uint32_t pair = cands[small[i]] | cands[small[j]];
+                    uint32_t cells = (1u << small[i]) | (1u << small[j]);
+
+                    if (2 == Sudoku_KernelCount(pair))
+                    {
+                        n += removeFromCells(p, unit, open & ~cells, pair);
+                        continue;
+                    }
+
+                    for (unsigned int k = j + 1; k < n_small; k++)
+                    {
+                        uint32_t triple = pair | cands[small[k]];
+
+                        if ((3 == Sudoku_KernelCount(triple)) && (3 < Sudoku_KernelCount(open)))
+                        {
+                            n += removeFromCells(p, unit, open & ~(cells | (1u << small[k])), triple);
+                        }
+                    }
+                }
+            }
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Hidden pairs and triples: n values of a unit confined to n cells.
+     *
+     * @return Number of candidates removed.
+     */
+    static unsigned int findHiddenSubsets(SudokuPuzzle_P p, const struct SudokuPlanes_S *planes)
+    {
+        unsigned int n = 0;
+
+        for (unsigned int unit = 0; unit < SUDOKU_NUM_UNITS; unit++)
+        {
+            uint8_t small[NUM_CANDIDATES];
+            unsigned int n_small = 0;
+
+            if (Sudoku_KernelCount(planes->missing[unit]) <= 2)
+            {
+                continue;
+            }
+
+            for (uint32_t missing = planes->missing[unit]; missing != 0; missing &= missing - 1)
+            {
+                unsigned int val = Sudoku_Kernels.lowest(missing);
+                unsigned int count = Sudoku_KernelCount(planes->place[val][unit]);
+
+                if ((2 <= count) && (count <= 3))
+                {
+                    small[n_small++] = (uint8_t)val;
+                }
+            }
+
+            for (unsigned int i = 0; i < n_small; i++)
+            {
+                for (unsigned int j = i + 1; j < n_small; j++)
+                {
+                    uint32_t pair = planes->place[small[i]][unit] | planes->place[small[j]][unit];
+                    uint32_t values = (1u << small[i]) | (1u << small[j]);
+
+                    if (2 == Sudoku_KernelCount(pair))
+                    {
+                        n += removeFromCells(p, unit, pair, SUDOKU_MASK_ALL & ~values);
+                        continue;
+                    }
+
+                    for (unsigned int k = j + 1; k < n_small; k++)
+                    {
+                        uint32_t triple = pair | planes->place[small[k]][unit];
+
+                        if ((3 == Sudoku_KernelCount(triple)) && (3 < Sudoku_KernelCount(planes->missing[unit])))
+                        {
+                            n += removeFromCells(p, unit, triple, SUDOKU_MASK_ALL & ~(values | (1u << small[k])));
+                        }
+                    }
+                }
+            }
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief X-Wings and Swordfish: a value confined to n columns in n rows is removed from the
+     *        other rows of those columns, and the same with rows and columns exchanged.
+     *
+     * @return Number of candidates removed.
+     */
+    static unsigned int findFish(SudokuPuzzle_P p, const struct SudokuPlanes_S *planes)
+    {
+        unsigned int n = 0;
+
+        for (unsigned int val = 0; val < NUM_CANDIDATES; val++)
+        {
+            for (unsigned int base = 0; base <= NUM_ROWS; base += NUM_ROWS)
+            {
+                const uint32_t *lines = &planes->place[val][base];
+                unsigned int cover = NUM_ROWS - base;
+                uint8_t small[NUM_ROWS];
+                unsigned int n_small = 0;
+
+                for (unsigned int line = 0; line < NUM_ROWS; line++)
+                {
+                    unsigned int count = Sudoku_KernelCount(lines[line]);
+
+                    if ((2 <= count) && (count <= 3))
+                    {
+                        small[n_small++] = (uint8_t)line;
+                    }
+                }
+
+                for (unsigned int i = 0; i < n_small; i++)
+                {
+                    for (unsigned int j = i + 1; j < n_small; j++)
+                    {
+                        uint32_t pair = lines[small[i]] | lines[small[j]];
+                        uint32_t base_lines = (1u << small[i]) | (1u << small[j]);
+
+                        if (2 == Sudoku_KernelCount(pair))
+                        {
+                            for (uint32_t covers = pair; covers != 0; covers &= covers - 1)
+                            {
+                                unsigned int unit = cover + Sudoku_Kernels.lowest(covers);
+                                n += removeFromCells(p, unit, planes->place[val][unit] & ~base_lines, 1u << val);
+                            }
+                            continue;
+                        }
+
+                        for (unsigned int k = j + 1; k < n_small; k++)
+                        {
+                            uint32_t triple = pair | lines[small[k]];
+
+                            if (3 == Sudoku_KernelCount(triple))
+                            {
+                                for (uint32_t covers = triple; covers != 0; covers &= covers - 1)
+                                {
+                                    unsigned int unit = cover + Sudoku_Kernels.lowest(covers);
+                                    n += removeFromCells(p, unit, planes->place[val][unit] & ~(base_lines | (1u << small[k])), 1u << val);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return n;
+    }
+
+    Sudoku_RC_T Sudoku_PropagatePuzzle(SudokuPuzzle_P p, Sudoku_Propagation_T level, Sudoku_PropagationStats_T *stats)
+    {
+        Sudoku_PropagationStats_T ignored;
+        struct SudokuPlanes_S planes;
+        unsigned int n_sweeps = 0;
+        Sudoku_RC_T rc;
+
+        if (NULL == p)
+        {
+            return SUDOKU_RC_NULL_POINTER;
+        }
+
+        stats = (NULL != stats) ? stats : &ignored;
+
+        for (;;)
+        {
+            rc = Sudoku_PrunePuzzle(p);
+            n_sweeps += p->n_sweeps;
+
+            if ((SUDOKU_RC_PRUNE != rc) || (SUDOKU_PROPAGATE_SINGLES == level))
+            {
+                break;
+            }
+
+            /* Cheapest technique first; prune again after any that removed candidates */
+            buildPlanes(p, &planes);
+
+            int singles = findHiddenSingles(p, &planes);
+            if (singles < 0)
+            {
+                p->n_conflicts++;
+                rc = SUDOKU_RC_ERROR;
+                break;
+            }
+            stats->hidden_singles += (unsigned int)singles;
+
+            unsigned int changes = (unsigned int)singles;
+            if ((0 == changes) && (level >= SUDOKU_PROPAGATE_LOCKED))
+            {
+                changes = findLockedCandidates(p, &planes);
+                stats->locked_eliminations += changes;
+            }
+            if ((0 == changes) && (level >= SUDOKU_PROPAGATE_SUBSETS))
+            {
+                changes = findNakedSubsets(p);
+                changes += (0 == changes) ? findHiddenSubsets(p, &planes) : 0;
+                stats->subset_eliminations += changes;
+            }
+            if ((0 == changes) && (level >= SUDOKU_PROPAGATE_FISH))
+            {
+                changes = findFish(p, &planes);
+                stats->fish_eliminations += changes;
+            }
+
+            if (0 == changes)
+            {
+                break;
+            }
+        }
+
+        p->n_sweeps = n_sweeps;
+
+        return rc;
+    }
+
+    void Sudoku_AccumulatePropagationStats(Sudoku_PropagationStats_T *total, const Sudoku_PropagationStats_T *stats)
+    {
+        total->hidden_singles += stats->hidden_singles;
+        total->locked_eliminations += stats->locked_eliminations;
+        total->subset_eliminations += stats->subset_eliminations;
+        total->fish_eliminations += stats->fish_eliminations;
+        total->probes += stats->probes;
+        total->probe_eliminations += stats->probe_eliminations;
+    }
+
+    /**
+     * @brief Probes the two candidates of a bivalue cell.
+     *
+     * @param p Puzzle, pruned.
+     * @param cell The cell.
+     * @param budget Probes left, decremented.
+     * @param stats Probe counters.
+     * @param n_sweeps Pruning passes, incremented by those of the probes.
+     * @return Number of candidates removed, or -1 if both candidates lead to a contradiction.
+     */
+    static int probeCell(SudokuPuzzle_P p, Sudoku_Propagation_T level, unsigned int cell, unsigned int *budget,
+                         Sudoku_PropagationStats_T *stats, unsigned int *n_sweeps)
+    {
+        const uint32_t cand = *cellCandidates(p, cell);
+        uint32_t allowed[NUM_ROWS * NUM_COLS];
+        uint32_t failed = 0;
+        unsigned int n_held = 0;
+        int n = 0;
+
+        (void)memset(allowed, 0, sizeof(allowed));
+
+        for (uint32_t remaining = cand; (remaining != 0) && (0 != *budget); remaining &= remaining - 1)
+        {
+            struct SudokuPuzzle_S scratch = *p;
+            uint32_t value = remaining & (~remaining + 1);
+
+            (*budget)--;
+            stats->probes++;
+            (void)Sudoku_SetValueUsingBitmask(&scratch, cell / NUM_COLS, cell % NUM_COLS, (Sudoku_BitValues_T)value);
+
+            Sudoku_RC_T rc = Sudoku_PropagatePuzzle(&scratch, level, NULL);
+            *n_sweeps += scratch.n_sweeps;
+
+            if (SUDOKU_RC_ERROR == rc)
+            {
+                failed |= value;
+                continue;
+            }
+
+            /* Values and candidates left in every cell by this branch */
+            for (unsigned int k = 0; k < NUM_ROWS * NUM_COLS; k++)
+            {
+                allowed[k] |= scratch.grid[k / NUM_COLS][k % NUM_COLS].value | scratch.grid[k / NUM_COLS][k % NUM_COLS].candidates;
+            }
+            n_held++;
+        }
+
+        if (failed == cand)
+        {
+            return -1;
+        }
+        else if (0 != failed)
+        {
+            *cellCandidates(p, cell) &= ~failed;
+            n = (int)Sudoku_KernelCount(failed);
+        }
+        else if (2 == n_held)
+        {
+            /* Candidates ruled out by both branches */
+            for (unsigned int k = 0; k < NUM_ROWS * NUM_COLS; k++)
+            {
+                uint32_t *other = cellCandidates(p, k);
+
+                n += (int)Sudoku_KernelCount(*other & ~allowed[k] & SUDOKU_MASK_ALL);
+                *other &= allowed[k];
+            }
+        }
+
+        stats->probe_eliminations += (unsigned int)n;
+
+        return n;
+    }
+
+    Sudoku_RC_T Sudoku_ProbePuzzle(SudokuPuzzle_P p, Sudoku_Propagation_T level, unsigned int budget, Sudoku_PropagationStats_T *stats)
+    {
+        Sudoku_PropagationStats_T ignored;
+        Sudoku_RC_T rc = Sudoku_PropagatePuzzle(p, level, stats);
+        unsigned int n_sweeps;
+
+        if (NULL == p)
+        {
+            return rc;
+        }
+
+        stats = (NULL != stats) ? stats : &ignored;
+        n_sweeps = p->n_sweeps;
+
+        /* Round-robin over the cells, until a full round removes nothing */
+        for (unsigned int cell = 0, idle = 0; (SUDOKU_RC_PRUNE == rc) && (0 != budget) && (idle < NUM_ROWS * NUM_COLS);
+             cell = (cell + 1 < NUM_ROWS * NUM_COLS) ? cell + 1 : 0)
+        {
+            int changes = 0;
+
+            if (2 == Sudoku_KernelCount(*cellCandidates(p, cell) & SUDOKU_MASK_ALL))
+            {
+                changes = probeCell(p, level, cell, &budget, stats, &n_sweeps);
+            }
+
+            if (changes < 0)
+            {
+                p->n_conflicts++;
+                rc = SUDOKU_RC_ERROR;
+            }
+            else if (0 == changes)
+            {
+                idle++;
+            }
+            else
+            {
+                rc = Sudoku_PropagatePuzzle(p, level, stats);
+                n_sweeps += p->n_sweeps;
+                idle = 0;
+            }
+        }
+
+        p->n_sweeps = n_sweeps;
+
+        return rc;
+    }
+
+#ifdef __cplusplus
+}
+#endif
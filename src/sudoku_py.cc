@@ -17,6 +17,11 @@ PYBIND11_MODULE(sudoku_solver, m) {
         .def("set_value", py::overload_cast<Sudoku_Row_Index_T, Sudoku_Column_Index_T, Sudoku_Values_T>(&SudokuPuzzle::SetValue))
         .def("get_value", &SudokuPuzzle::GetValue)
         .def("solve", py::overload_cast<>(&SudokuPuzzle::Solve))
+        .def("solve", py::overload_cast<Sudoku_Engine_T>(&SudokuPuzzle::Solve))
+        .def("count_solutions", [](SudokuPuzzle &self, unsigned long limit, Sudoku_Engine_T engine) {
+            unsigned long count = 0;
+            (void)self.CountSolutions(count, limit, engine);
+            return count; }, py::arg("limit"), py::arg("engine") = SUDOKU_ENGINE_PRUNE)
         .def("get_puzzle", &SudokuPuzzle::GetPuzzleAsString)
         .def("check", &SudokuPuzzle::Check);
 
@@ -28,6 +33,14 @@ PYBIND11_MODULE(sudoku_solver, m) {
         .value("SUDOKU_RC_NOT_SOLVABLE", Sudoku_RC_E::SUDOKU_RC_NOT_SOLVABLE)
         .value("SUDOKU_RC_SUCCESS", Sudoku_RC_E::SUDOKU_RC_SUCCESS)  
         .value("SUDOKU_RC_PRUNE", Sudoku_RC_E::SUDOKU_RC_NULL_POINTER)
+        .value("SUDOKU_RC_CANCELLED", Sudoku_RC_E::SUDOKU_RC_CANCELLED)
+        .value("SUDOKU_RC_BUDGET_EXHAUSTED", Sudoku_RC_E::SUDOKU_RC_BUDGET_EXHAUSTED)
+        .export_values();
+
+    py::enum_<Sudoku_Engine_T>(m, "SudokuEngine")
+        .value("SUDOKU_ENGINE_PRUNE", Sudoku_Engine_E::SUDOKU_ENGINE_PRUNE)
+        .value("SUDOKU_ENGINE_DLX", Sudoku_Engine_E::SUDOKU_ENGINE_DLX)
+        .value("SUDOKU_ENGINE_BACKJUMP", Sudoku_Engine_E::SUDOKU_ENGINE_BACKJUMP)
         .export_values();
 
     py::enum_<SudokuValues_E>(m, "SudokuValues")
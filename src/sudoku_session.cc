@@ -0,0 +1,405 @@
+/**
+ * @file
+ * @brief Interactive puzzle session with incremental candidates and cached solvability
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_session.hh"
+
+#include <cstring>
+
+/* Give access to private C-Library*/
+#include "_sudoku.h"
+#include "_sudoku_dlx.h"
+
+/* Node arena of the searches, reused by every session on the same thread */
+static thread_local struct SudokuDLX_S session_arena;
+
+/**
+ * @brief Row, column and subgrid unit indexes of a cell.
+ */
+static inline void CellUnits(unsigned int cell, unsigned int units[3])
+{
+    unsigned int row = cell / NUM_COLS;
+    unsigned int col = cell % NUM_COLS;
+
+    units[0] = row;
+    units[1] = NUM_ROWS + col;
+    units[2] = 2 * NUM_ROWS + 3 * (row / 3) + col / 3;
+}
+
+/**
+ * @brief Cells of a unit, as indexed by CellUnits().
+ */
+static inline unsigned int UnitCell(unsigned int unit, unsigned int k)
+{
+    if (unit < NUM_ROWS)
+    {
+        return unit * NUM_COLS + k;
+    }
+    else if (unit < 2 * NUM_ROWS)
+    {
+        return k * NUM_COLS + (unit - NUM_ROWS);
+    }
+
+    unsigned int sub = unit - 2 * NUM_ROWS;
+    return (3 * (sub / 3) + k / 3) * NUM_COLS + 3 * (sub % 3) + k % 3;
+}
+
+/**
+ * @brief Decodes the placements of a Dancing Links solution into cell values.
+ */
+static void DecodeSolution(const Sudoku_DLX_Index_T *placements, uint8_t *values)
+{
+    for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+    {
+        values[placements[i] / NUM_CANDIDATES] = (uint8_t)(placements[i] % NUM_CANDIDATES + 1);
+    }
+}
+
+SudokuSession::SudokuSession(void)
+{
+    (void)this->Load(std::string(NUM_ROWS * NUM_COLS, '0'));
+}
+
+SudokuSession::SudokuSession(const std::string &p)
+{
+    if (SUDOKU_RC_SUCCESS != this->Load(p))
+    {
+        (void)this->Load(std::string(NUM_ROWS * NUM_COLS, '0'));
+    }
+}
+
+Sudoku_RC_T SudokuSession::Load(const std::string &p)
+{
+    if (p.length() < NUM_ROWS * NUM_COLS)
+    {
+        return SUDOKU_RC_INVALID_INPUT;
+    }
+
+    (void)memset(this->values, 0, sizeof(this->values));
+    (void)memset(this->counts, 0, sizeof(this->counts));
+    (void)memset(this->used, 0, sizeof(this->used));
+    (void)memset(this->dead, 0, sizeof(this->dead));
+    this->n_filled = 0;
+    this->n_conflicts = 0;
+    this->n_dead = 0;
+    this->n_searches = 0;
+    this->solution.valid = false;
+    this->alternative.valid = false;
+    this->unique.valid = false;
+    this->unsolvable.valid = false;
+
+    for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+    {
+        char c = p[cell];
+        bool is_value = (c >= '1') && (c <= '9');
+
+        this->given[cell] = is_value;
+        if (is_value)
+        {
+            this->Assign(cell, (uint8_t)(c - '0'));
+        }
+    }
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_RC_T SudokuSession::Place(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col, Sudoku_Values_T val)
+{
+    if ((row >= NUM_ROWS) || (col >= NUM_COLS) || this->given[row * NUM_COLS + col])
+    {
+        return SUDOKU_RC_INVALID_INPUT;
+    }
+    else if ((val < SUDOKU_VALUE_1) || (val > SUDOKU_VALUE_9))
+    {
+        return SUDOKU_RC_INVALID_VALUE;
+    }
+
+    this->Assign((unsigned int)(row * NUM_COLS + col), (uint8_t)val);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_RC_T SudokuSession::Erase(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col)
+{
+    if ((row >= NUM_ROWS) || (col >= NUM_COLS) || this->given[row * NUM_COLS + col])
+    {
+        return SUDOKU_RC_INVALID_INPUT;
+    }
+
+    this->Assign((unsigned int)(row * NUM_COLS + col), 0);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_Values_T SudokuSession::GetValue(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+{
+    if ((row >= NUM_ROWS) || (col >= NUM_COLS))
+    {
+        return SUDOKU_INVALID_VALUE;
+    }
+
+    return (Sudoku_Values_T)this->values[row * NUM_COLS + col];
+}
+
+uint32_t SudokuSession::GetCandidates(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+{
+    if ((row >= NUM_ROWS) || (col >= NUM_COLS) || (0 != this->values[row * NUM_COLS + col]))
+    {
+        return SUDOKU_MASK_NONE;
+    }
+
+    unsigned int units[3];
+    CellUnits((unsigned int)(row * NUM_COLS + col), units);
+
+    return SUDOKU_MASK_ALL & ~(this->used[units[0]] | this->used[units[1]] | this->used[units[2]]);
+}
+
+bool SudokuSession::IsGiven(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+{
+    return (row < NUM_ROWS) && (col < NUM_COLS) && this->given[row * NUM_COLS + col];
+}
+
+bool SudokuSession::IsConflicting(Sudoku_Row_Index_T row, Sudoku_Column_Index_T col) const
+{
+    if ((row >= NUM_ROWS) || (col >= NUM_COLS) || (0 == this->values[row * NUM_COLS + col]))
+    {
+        return false;
+    }
+
+    unsigned int units[3];
+    unsigned int val = this->values[row * NUM_COLS + col] - 1;
+    CellUnits((unsigned int)(row * NUM_COLS + col), units);
+
+    return (this->counts[units[0]][val] > 1) || (this->counts[units[1]][val] > 1) || (this->counts[units[2]][val] > 1);
+}
+
+bool SudokuSession::IsValid(void) const
+{
+    return (0 == this->n_conflicts) && (0 == this->n_dead);
+}
+
+bool SudokuSession::IsComplete(void) const
+{
+    return (NUM_ROWS * NUM_COLS == this->n_filled) && this->IsValid();
+}
+
+bool SudokuSession::IsSolvable(void)
+{
+    if (!this->IsValid())
+    {
+        return false;
+    }
+    else if (this->Covers(this->solution) || this->Covers(this->alternative))
+    {
+        return true;
+    }
+    else if (this->Covers(this->unsolvable))
+    {
+        return false;
+    }
+
+    this->Search();
+
+    return this->Covers(this->solution);
+}
+
+bool SudokuSession::IsUnique(void)
+{
+    if (!this->IsSolvable())
+    {
+        return false;
+    }
+    else if (this->Covers(this->solution) && this->Covers(this->alternative))
+    {
+        return false;
+    }
+    else if (this->Covers(this->solution) && this->Covers(this->unique))
+    {
+        return true;
+    }
+
+    this->Search();
+
+    return this->Covers(this->solution) && !this->Covers(this->alternative);
+}
+
+SudokuPuzzle SudokuSession::GetPuzzle(void) const
+{
+    return SudokuPuzzle(this->GetPuzzleAsString());
+}
+
+std::string SudokuSession::GetPuzzleAsString(void) const
+{
+    std::string p(NUM_ROWS * NUM_COLS, '0');
+
+    for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+    {
+        p[cell] = (char)('0' + this->values[cell]);
+    }
+
+    return p;
+}
+
+unsigned long SudokuSession::Searches(void) const
+{
+    return this->n_searches;
+}
+
+unsigned int SudokuSession::Mismatch(const Reference &ref, unsigned int cell, uint8_t val)
+{
+    if (ref.complete)
+    {
+        /* A solution covers the grid if every value of the grid matches */
+        return ((0 != val) && (val != ref.values[cell])) ? 1 : 0;
+    }
+
+    /* A proof covers the grid if the grid holds every value of the proven grid */
+    return ((0 != ref.values[cell]) && (val != ref.values[cell])) ? 1 : 0;
+}
+
+/**
+ * @brief Changes the value of a cell and updates the unit counts, dead cells and references.
+ *
+ * Only the units of the cell change, so only the cell and its peers can become dead or alive.
+ */
+void SudokuSession::Assign(unsigned int cell, uint8_t val)
+{
+    const uint8_t old = this->values[cell];
+    unsigned int units[3];
+
+    if (old == val)
+    {
+        return;
+    }
+
+    for (Reference *ref : {&this->solution, &this->alternative, &this->unique, &this->unsolvable})
+    {
+        if (ref->valid)
+        {
+            ref->mismatches -= Mismatch(*ref, cell, old);
+            ref->mismatches += Mismatch(*ref, cell, val);
+        }
+    }
+
+    CellUnits(cell, units);
+    for (unsigned int u : units)
+    {
+        if (0 != old)
+        {
+            if (this->counts[u][old - 1]-- > 1)
+            {
+                this->n_conflicts--;
+            }
+            if (0 == this->counts[u][old - 1])
+            {
+                this->used[u] &= ~((uint32_t)1 << (old - 1));
+            }
+        }
+        if (0 != val)
+        {
+            if (this->counts[u][val - 1]++ > 0)
+            {
+                this->n_conflicts++;
+            }
+            this->used[u] |= (uint32_t)1 << (val - 1);
+        }
+    }
+
+    this->n_filled = this->n_filled - ((0 != old) ? 1 : 0) + ((0 != val) ? 1 : 0);
+    this->values[cell] = val;
+
+    for (unsigned int u : units)
+    {
+        for (unsigned int k = 0; k < NUM_SUBGRID_ELEMENTS; k++)
+        {
+            unsigned int peer = UnitCell(u, k);
+            bool is_dead = (0 == this->values[peer]) &&
+                           (SUDOKU_MASK_NONE == this->GetCandidates(peer / NUM_COLS, peer % NUM_COLS));
+
+            if (is_dead != this->dead[peer])
+            {
+                this->dead[peer] = is_dead;
+                this->n_dead = is_dead ? this->n_dead + 1 : this->n_dead - 1;
+            }
+        }
+    }
+}
+
+void SudokuSession::Remember(Reference &ref, const uint8_t *grid, bool complete)
+{
+    (void)memcpy(ref.values, grid, sizeof(ref.values));
+    ref.complete = complete;
+    ref.valid = true;
+    ref.mismatches = 0;
+
+    for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+    {
+        ref.mismatches += Mismatch(ref, cell, this->values[cell]);
+    }
+}
+
+bool SudokuSession::Covers(const Reference &ref) const
+{
+    return ref.valid && (0 == ref.mismatches);
+}
+
+/**
+ * @brief Searches for up to two solutions of the current grid and remembers the result.
+ *
+ * The search starts from the incremental candidates, so the exact cover matrix only holds the
+ * placements still allowed by the units.
+ */
+void SudokuSession::Search(void)
+{
+    struct SudokuPuzzle_S p;
+    uint8_t grid[NUM_ROWS * NUM_COLS];
+
+    (void)Sudoku_InitializePuzzle(&p);
+    for (unsigned int cell = 0; cell < NUM_ROWS * NUM_COLS; cell++)
+    {
+        Sudoku_Row_Index_T row = cell / NUM_COLS;
+        Sudoku_Column_Index_T col = cell % NUM_COLS;
+
+        (void)Sudoku_SetValue(&p, row, col, this->values[cell]);
+        if (0 == this->values[cell])
+        {
+            p.grid[row][col].candidates = this->GetCandidates(row, col);
+        }
+    }
+
+    this->n_searches++;
+    (void)Sudoku_DLX_Solve(&session_arena, &p, 2);
+
+    if (0 == session_arena.n_solutions)
+    {
+        this->Remember(this->unsolvable, this->values, false);
+        return;
+    }
+
+    DecodeSolution(session_arena.solution, grid);
+
+    if (1 == session_arena.n_solutions)
+    {
+        /* A different earlier solution no longer covers the grid but may again after an erase */
+        if (this->solution.valid && (0 != memcmp(this->solution.values, grid, sizeof(grid))))
+        {
+            this->alternative = this->solution;
+        }
+        else if (this->alternative.valid && (0 == memcmp(this->alternative.values, grid, sizeof(grid))))
+        {
+            this->alternative.valid = false;
+        }
+
+        this->Remember(this->solution, grid, true);
+        this->Remember(this->unique, this->values, false);
+        return;
+    }
+
+    this->Remember(this->solution, grid, true);
+
+    DecodeSolution(session_arena.second, grid);
+    this->Remember(this->alternative, grid, true);
+}
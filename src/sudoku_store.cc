@@ -0,0 +1,588 @@
+/**
+ * @file
+ * @brief Persistent memory-mapped solution store
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_store.hh"
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char store_magic[8] = {'S', 'U', 'D', 'O', 'K', 'U', 'D', 'B'};
+static const uint32_t store_version = 2;
+
+enum StoreSlotState_E : uint32_t
+{
+    STORE_SLOT_EMPTY = 0,
+    STORE_SLOT_FULL = 1,
+    STORE_SLOT_ERASED = 2,
+};
+
+/**
+ * @brief File header. The counters are only written by the writer.
+ */
+struct StoreHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t slot_size;
+    uint64_t capacity;                 /**< Number of slots, a power of two. */
+    std::atomic<uint64_t> count;       /**< Number of stored entries. */
+    std::atomic<uint64_t> erased;      /**< Number of erased slots. */
+    std::atomic<uint32_t> superseded;  /**< Set once the file has been replaced by a compaction. */
+    uint8_t reserved[20];
+};
+
+/**
+ * @brief Table slot. The key and record are written before the state is published and never change afterwards.
+ *
+ * The statistics of the solve are stored except the transposition table counters, which describe the table
+ * of the solving process rather than the puzzle. The maximum level of a search is at most 81.
+ */
+struct StoreSlot
+{
+    std::atomic<uint32_t> state;
+    uint32_t hash;
+    uint32_t solve_calls;
+    uint32_t backtracks;
+    uint32_t prune_sweeps;
+    Sudoku_PropagationStats_T propagation;
+    SudokuPackedGrid key;
+    SudokuPackedGrid solution;
+    uint8_t max_level;
+    uint8_t reserved[1];
+};
+
+static_assert(64 == sizeof(StoreHeader), "Unexpected store header size");
+static_assert(128 == sizeof(StoreSlot), "Unexpected store slot size");
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory atomics must be lock-free");
+
+struct SudokuStoreMapping
+{
+    int fd;
+    void *base;
+    size_t length;
+    StoreHeader *header;
+    StoreSlot *slots;
+    uint64_t mask;
+};
+
+void Sudoku_PackGrid(SudokuPuzzle &puzzle, SudokuPackedGrid &packed)
+{
+    packed.fill(0);
+
+    for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+    {
+        int val = (int)puzzle.GetValue(i / NUM_COLS, i % NUM_COLS);
+        uint8_t nibble = (val > 0 && val <= NUM_CANDIDATES) ? (uint8_t)val : 0;
+
+        packed[i / 2] |= (i & 1) ? (uint8_t)(nibble << 4) : nibble;
+    }
+}
+
+Sudoku_RC_T Sudoku_UnpackGrid(const SudokuPackedGrid &packed, SudokuPuzzle &puzzle)
+{
+    for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+    {
+        unsigned int val = (i & 1) ? (packed[i / 2] >> 4) : (packed[i / 2] & 0x0F);
+
+        if (val > NUM_CANDIDATES)
+        {
+            return SUDOKU_RC_INVALID_VALUE;
+        }
+        else if (val > 0)
+        {
+            (void)puzzle.SetValue(i / NUM_COLS, i % NUM_COLS, (Sudoku_Values_T)val);
+        }
+    }
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+/**
+ * @brief FNV-1a hash of a packed puzzle.
+ */
+static uint64_t StoreHash(const SudokuPackedGrid &key)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (auto byte : key)
+    {
+        hash = (hash ^ byte) * 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+static size_t StoreFileSize(uint64_t capacity)
+{
+    return sizeof(StoreHeader) + (size_t)capacity * sizeof(StoreSlot);
+}
+
+static void StoreUnmap(SudokuStoreMapping *m);
+
+/**
+ * @brief Maps a store file and validates its header.
+ */
+static Sudoku_RC_T StoreMap(const std::string &path, bool writable, SudokuStoreMapping *&m)
+{
+    struct stat st;
+    int fd = open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+
+    if (fd < 0)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    if (0 != fstat(fd, &st) || (size_t)st.st_size < sizeof(StoreHeader))
+    {
+        close(fd);
+        return SUDOKU_RC_INVALID_INPUT;
+    }
+
+    void *base = mmap(nullptr, (size_t)st.st_size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == base)
+    {
+        close(fd);
+        return SUDOKU_RC_ERROR;
+    }
+
+    m = new SudokuStoreMapping{fd, base, (size_t)st.st_size, static_cast<StoreHeader *>(base), nullptr, 0};
+
+    const StoreHeader *h = m->header;
+    if (0 != memcmp(h->magic, store_magic, sizeof(store_magic)) || store_version != h->version ||
+        sizeof(StoreSlot) != h->slot_size || 0 == h->capacity || (h->capacity & (h->capacity - 1)) ||
+        StoreFileSize(h->capacity) != m->length)
+    {
+        StoreUnmap(m);
+        m = nullptr;
+        return SUDOKU_RC_INVALID_INPUT;
+    }
+
+    m->slots = reinterpret_cast<StoreSlot *>(static_cast<uint8_t *>(base) + sizeof(StoreHeader));
+    m->mask = h->capacity - 1;
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+static void StoreUnmap(SudokuStoreMapping *m)
+{
+    if (nullptr != m)
+    {
+        (void)munmap(m->base, m->length);
+        (void)close(m->fd);
+        delete m;
+    }
+}
+
+/**
+ * @brief Finds the slot of a key, or the first empty slot of its probe sequence.
+ *
+ * @p state is the state of the returned slot as observed by the probe; the slot may be filled concurrently afterwards.
+ */
+static StoreSlot *StoreProbe(const SudokuStoreMapping *m, const SudokuPackedGrid &key, uint64_t hash, uint32_t &state)
+{
+    for (uint64_t n = 0, i = hash & m->mask; n <= m->mask; n++, i = (i + 1) & m->mask)
+    {
+        StoreSlot *slot = &m->slots[i];
+        state = slot->state.load(std::memory_order_acquire);
+
+        if (STORE_SLOT_EMPTY == state)
+        {
+            return slot;
+        }
+        else if ((uint32_t)hash == slot->hash && key == slot->key)
+        {
+            return slot;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Writes a new, empty store file next to @p path and returns the name of the temporary file.
+ */
+static Sudoku_RC_T StoreCreate(const std::string &path, uint64_t capacity, std::string &tmp_path)
+{
+    tmp_path = path + ".tmp";
+
+    int fd = open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    StoreHeader header{};
+    (void)memcpy(header.magic, store_magic, sizeof(store_magic));
+    header.version = store_version;
+    header.slot_size = sizeof(StoreSlot);
+    header.capacity = capacity;
+
+    bool ok = (0 == ftruncate(fd, (off_t)StoreFileSize(capacity))) &&
+              (sizeof(header) == pwrite(fd, &header, sizeof(header), 0));
+    (void)close(fd);
+
+    return ok ? SUDOKU_RC_SUCCESS : SUDOKU_RC_ERROR;
+}
+
+SudokuSolutionStore::SudokuSolutionStore(void) : writable(false), lock_fd(-1), mapping(nullptr), hits(0), misses(0)
+{
+}
+
+SudokuSolutionStore::~SudokuSolutionStore(void)
+{
+    Close();
+}
+
+Sudoku_RC_T SudokuSolutionStore::Open(const std::string &path, bool writable, size_t capacity)
+{
+    Close();
+
+    this->path = path;
+    this->writable = writable;
+
+    if (writable)
+    {
+        lock_fd = open((path + ".lock").c_str(), O_RDWR | O_CREAT, 0644);
+        if (lock_fd < 0 || 0 != flock(lock_fd, LOCK_EX | LOCK_NB))
+        {
+            Close();
+            return SUDOKU_RC_ERROR; /* Another writer owns the store */
+        }
+
+        if (0 != access(path.c_str(), F_OK))
+        {
+            uint64_t slots = 1;
+            std::string tmp_path;
+
+            while (slots < capacity)
+            {
+                slots <<= 1;
+            }
+
+            if (SUDOKU_RC_SUCCESS != StoreCreate(path, slots, tmp_path) || 0 != rename(tmp_path.c_str(), path.c_str()))
+            {
+                Close();
+                return SUDOKU_RC_ERROR;
+            }
+        }
+    }
+
+    SudokuStoreMapping *m = nullptr;
+    Sudoku_RC_T rc = StoreMap(path, writable, m);
+    if (SUDOKU_RC_SUCCESS != rc)
+    {
+        Close();
+        return rc;
+    }
+
+    mapping.store(m, std::memory_order_release);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+void SudokuSolutionStore::Close(void)
+{
+    std::lock_guard<std::mutex> lock(remap_mutex);
+
+    SudokuStoreMapping *m = mapping.exchange(nullptr);
+
+    if (nullptr != m && writable)
+    {
+        (void)msync(m->base, m->length, MS_SYNC);
+    }
+
+    StoreUnmap(m);
+    for (auto r : retired)
+    {
+        StoreUnmap(r);
+    }
+    retired.clear();
+
+    if (lock_fd >= 0)
+    {
+        (void)close(lock_fd); /* Releases the writer lock */
+        lock_fd = -1;
+    }
+}
+
+SudokuStoreMapping *SudokuSolutionStore::Current(void)
+{
+    SudokuStoreMapping *m = mapping.load(std::memory_order_acquire);
+
+    if (nullptr != m && m->header->superseded.load(std::memory_order_acquire))
+    {
+        (void)Remap();
+        m = mapping.load(std::memory_order_acquire);
+    }
+
+    return m;
+}
+
+Sudoku_RC_T SudokuSolutionStore::Remap(void)
+{
+    std::lock_guard<std::mutex> lock(remap_mutex);
+
+    SudokuStoreMapping *old = mapping.load(std::memory_order_acquire);
+    if (nullptr == old || !old->header->superseded.load(std::memory_order_acquire))
+    {
+        return SUDOKU_RC_SUCCESS; /* Already switched by another thread */
+    }
+
+    SudokuStoreMapping *m = nullptr;
+    Sudoku_RC_T rc = StoreMap(path, writable, m);
+    if (SUDOKU_RC_SUCCESS == rc)
+    {
+        /* Lookups may still be probing the old mapping */
+        mapping.store(m, std::memory_order_release);
+        retired.push_back(old);
+    }
+
+    return rc;
+}
+
+bool SudokuSolutionStore::Lookup(const SudokuPackedGrid &key, Record &record)
+{
+    const SudokuStoreMapping *m = Current();
+
+    if (nullptr == m)
+    {
+        return false;
+    }
+
+    uint32_t state;
+    const StoreSlot *slot = StoreProbe(m, key, StoreHash(key), state);
+
+    if (nullptr == slot || STORE_SLOT_FULL != state)
+    {
+        return false;
+    }
+
+    record.solution = slot->solution;
+    record.stats = {};
+    record.stats.max_level = slot->max_level;
+    record.stats.solve_calls = slot->solve_calls;
+    record.stats.backtracks = slot->backtracks;
+    record.stats.prune_sweeps = slot->prune_sweeps;
+    record.stats.propagation = slot->propagation;
+
+    return true;
+}
+
+Sudoku_RC_T SudokuSolutionStore::Rebuild(size_t capacity)
+{
+    SudokuStoreMapping *old = mapping.load(std::memory_order_acquire);
+    uint64_t slots = 1;
+    std::string tmp_path;
+
+    while (slots < capacity || slots < 2 * old->header->count.load())
+    {
+        slots <<= 1;
+    }
+
+    if (SUDOKU_RC_SUCCESS != StoreCreate(path, slots, tmp_path))
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    SudokuStoreMapping *m = nullptr;
+    if (SUDOKU_RC_SUCCESS != StoreMap(tmp_path, true, m))
+    {
+        (void)unlink(tmp_path.c_str());
+        return SUDOKU_RC_ERROR;
+    }
+
+    uint64_t count = 0;
+    for (uint64_t i = 0; i <= old->mask; i++)
+    {
+        const StoreSlot &src = old->slots[i];
+
+        if (STORE_SLOT_FULL == src.state.load(std::memory_order_acquire))
+        {
+            uint32_t state;
+            StoreSlot *dst = StoreProbe(m, src.key, StoreHash(src.key), state);
+
+            (void)memcpy(reinterpret_cast<uint8_t *>(dst) + sizeof(dst->state),
+                         reinterpret_cast<const uint8_t *>(&src) + sizeof(src.state),
+                         sizeof(StoreSlot) - sizeof(src.state));
+            dst->state.store(STORE_SLOT_FULL, std::memory_order_relaxed);
+            count++;
+        }
+    }
+    m->header->count.store(count, std::memory_order_relaxed);
+
+    /* Make the new file durable before it replaces the old one */
+    if (0 != msync(m->base, m->length, MS_SYNC) || 0 != rename(tmp_path.c_str(), path.c_str()))
+    {
+        StoreUnmap(m);
+        (void)unlink(tmp_path.c_str());
+        return SUDOKU_RC_ERROR;
+    }
+
+    mapping.store(m, std::memory_order_release);
+    old->header->superseded.store(1, std::memory_order_release);
+    retired.push_back(old);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_RC_T SudokuSolutionStore::Insert(const SudokuPackedGrid &key, const Record &record)
+{
+    std::lock_guard<std::mutex> lock(remap_mutex);
+
+    SudokuStoreMapping *m = mapping.load(std::memory_order_acquire);
+    if (!writable || nullptr == m)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    uint64_t hash = StoreHash(key);
+    uint32_t state;
+    StoreSlot *slot = StoreProbe(m, key, hash, state);
+
+    if (nullptr != slot && STORE_SLOT_FULL == state)
+    {
+        return SUDOKU_RC_SUCCESS;
+    }
+
+    /* Keep the load factor (including erased slots) below 3/4. Erased slots are never reused in place. */
+    uint64_t used = m->header->count.load() + m->header->erased.load();
+    if (nullptr == slot || STORE_SLOT_EMPTY != state || 4 * (used + 1) > 3 * m->header->capacity)
+    {
+        if (SUDOKU_RC_SUCCESS != Rebuild((size_t)m->header->capacity))
+        {
+            return SUDOKU_RC_ERROR;
+        }
+
+        m = mapping.load(std::memory_order_acquire);
+        slot = StoreProbe(m, key, hash, state);
+    }
+
+    slot->hash = (uint32_t)hash;
+    slot->solve_calls = record.stats.solve_calls;
+    slot->backtracks = record.stats.backtracks;
+    slot->prune_sweeps = record.stats.prune_sweeps;
+    slot->propagation = record.stats.propagation;
+    slot->max_level = (uint8_t)((record.stats.max_level < UINT8_MAX) ? record.stats.max_level : UINT8_MAX);
+    slot->key = key;
+    slot->solution = record.solution;
+    slot->state.store(STORE_SLOT_FULL, std::memory_order_release);
+    m->header->count.fetch_add(1, std::memory_order_relaxed);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_RC_T SudokuSolutionStore::Erase(const SudokuPackedGrid &key)
+{
+    std::lock_guard<std::mutex> lock(remap_mutex);
+
+    SudokuStoreMapping *m = mapping.load(std::memory_order_acquire);
+    if (!writable || nullptr == m)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    uint32_t state;
+    StoreSlot *slot = StoreProbe(m, key, StoreHash(key), state);
+    if (nullptr == slot || STORE_SLOT_FULL != state)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    slot->state.store(STORE_SLOT_ERASED, std::memory_order_release);
+    m->header->count.fetch_sub(1, std::memory_order_relaxed);
+    m->header->erased.fetch_add(1, std::memory_order_relaxed);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+Sudoku_RC_T SudokuSolutionStore::Compact(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(remap_mutex);
+
+    SudokuStoreMapping *m = mapping.load(std::memory_order_acquire);
+    if (!writable || nullptr == m)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    return Rebuild((0 == capacity) ? (size_t)m->header->capacity : capacity);
+}
+
+Sudoku_RC_T SudokuSolutionStore::Flush(void)
+{
+    std::lock_guard<std::mutex> lock(remap_mutex);
+
+    SudokuStoreMapping *m = mapping.load(std::memory_order_acquire);
+    if (!writable || nullptr == m)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+
+    return (0 == msync(m->base, m->length, MS_SYNC)) ? SUDOKU_RC_SUCCESS : SUDOKU_RC_ERROR;
+}
+
+Sudoku_RC_T SudokuSolutionStore::Solve(SudokuPuzzle &puzzle, SudokuSolveStats *stats)
+{
+    SudokuPackedGrid key;
+    Record record = {};
+
+    Sudoku_PackGrid(puzzle, key);
+
+    if (Lookup(key, record))
+    {
+        hits++;
+        if (nullptr != stats)
+        {
+            *stats = record.stats;
+        }
+        return Sudoku_UnpackGrid(record.solution, puzzle);
+    }
+
+    misses++;
+
+    auto rc = puzzle.Solve(SudokuSolveOptions(), &record.stats);
+
+    if (SUDOKU_RC_SUCCESS == rc && writable)
+    {
+        Sudoku_PackGrid(puzzle, record.solution);
+        (void)Insert(key, record);
+    }
+
+    if (nullptr != stats)
+    {
+        *stats = record.stats;
+    }
+
+    return rc;
+}
+
+size_t SudokuSolutionStore::Size(void)
+{
+    const SudokuStoreMapping *m = Current();
+    return (nullptr != m) ? (size_t)m->header->count.load(std::memory_order_relaxed) : 0;
+}
+
+size_t SudokuSolutionStore::Capacity(void)
+{
+    const SudokuStoreMapping *m = Current();
+    return (nullptr != m) ? (size_t)m->header->capacity : 0;
+}
+
+unsigned long SudokuSolutionStore::Hits(void) const
+{
+    return hits.load();
+}
+
+unsigned long SudokuSolutionStore::Misses(void) const
+{
+    return misses.load();
+}
@@ -0,0 +1,158 @@
+/**
+ * @file
+ * @brief Streaming reader for plain or gzip-compressed text datasets
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_stream.hh"
+
+#include <cstring>
+
+#include <zlib.h>
+
+/* Size of the zlib input and output buffers */
+static const unsigned int stream_buffer_size = 1 << 17;
+
+SudokuPuzzleStream::SudokuPuzzleStream(size_t batch_size, size_t max_batches)
+    : batch_size((batch_size > 0) ? batch_size : 1), max_batches((max_batches > 0) ? max_batches : 1),
+      finished(true), stopped(false), status(SUDOKU_RC_SUCCESS), count(0)
+{
+}
+
+SudokuPuzzleStream::~SudokuPuzzleStream(void)
+{
+    Close();
+}
+
+Sudoku_RC_T SudokuPuzzleStream::Open(const std::string &file_name)
+{
+    Close();
+
+    /* gzopen() reads files without a gzip header as plain text */
+    gzFile file = gzopen(file_name.c_str(), "rb");
+    if (nullptr == file)
+    {
+        return SUDOKU_RC_ERROR;
+    }
+    (void)gzbuffer(file, stream_buffer_size);
+
+    batches.clear();
+    finished = false;
+    stopped = false;
+    status = SUDOKU_RC_SUCCESS;
+    count = 0;
+
+    reader = std::thread(&SudokuPuzzleStream::Read, this, (void *)file);
+
+    return SUDOKU_RC_SUCCESS;
+}
+
+void SudokuPuzzleStream::Read(void *handle)
+{
+    gzFile file = static_cast<gzFile>(handle);
+    std::vector<std::string> batch;
+    char line[128];
+    bool partial = false; /* Inside a line longer than the buffer */
+
+    batch.reserve(batch_size);
+
+    while (nullptr != gzgets(file, line, sizeof(line)))
+    {
+        size_t length = strlen(line);
+        bool complete = (length > 0) && ('\n' == line[length - 1]);
+        bool skip = partial;
+
+        partial = !complete && !gzeof(file);
+        while ((length > 0) && ('\n' == line[length - 1] || '\r' == line[length - 1]))
+        {
+            length--;
+        }
+
+        if (skip || partial || (NUM_ROWS * NUM_COLS) != length)
+        {
+            continue;
+        }
+
+        batch.emplace_back(line, length);
+        count++;
+
+        if (batch.size() == batch_size)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [this]
+                          { return stopped || batches.size() < max_batches; });
+            if (stopped)
+            {
+                break;
+            }
+
+            batches.push_back(std::move(batch));
+            batch = std::vector<std::string>();
+            batch.reserve(batch_size);
+            not_empty.notify_one();
+        }
+    }
+
+    /* Corrupt data, or Z_BUF_ERROR for a truncated gzip stream */
+    int error = Z_OK;
+    (void)gzerror(file, &error);
+    if (Z_OK != error)
+    {
+        status = SUDOKU_RC_ERROR;
+    }
+    (void)gzclose(file);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!batch.empty() && !stopped)
+    {
+        batches.push_back(std::move(batch));
+    }
+    finished = true;
+    not_empty.notify_all();
+}
+
+bool SudokuPuzzleStream::Next(std::vector<std::string> &batch)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    not_empty.wait(lock, [this]
+                   { return !batches.empty() || finished || stopped; });
+
+    if (batches.empty())
+    {
+        return false;
+    }
+
+    batch = std::move(batches.front());
+    batches.pop_front();
+    not_full.notify_one();
+
+    return true;
+}
+
+void SudokuPuzzleStream::Close(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+
+    if (reader.joinable())
+    {
+        reader.join();
+    }
+
+    batches.clear();
+}
+
+Sudoku_RC_T SudokuPuzzleStream::Status(void) const
+{
+    return status;
+}
+
+unsigned long SudokuPuzzleStream::Count(void) const
+{
+    return count;
+}
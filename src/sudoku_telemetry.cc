@@ -0,0 +1,162 @@
+/**
+ * @file
+ * @brief Per-puzzle solve telemetry, streamed as CSV or JSON Lines with summary histograms
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_telemetry.hh"
+
+#include <chrono>
+#include <cstring>
+
+static const char *const field_names[SudokuTelemetry::NUM_FIELDS] = {
+    "clues", "nodes", "backtracks", "max_depth", "prune_sweeps", "ns"};
+
+SudokuTelemetry::SudokuTelemetry(std::ostream &out, SudokuTelemetryFormat format)
+    : out(out), format(format), count(0)
+{
+    (void)memset(sums, 0, sizeof(sums));
+    (void)memset(maxima, 0, sizeof(maxima));
+    (void)memset(histograms, 0, sizeof(histograms));
+
+    if (SudokuTelemetryFormat::CSV == format)
+    {
+        out << "index,rc";
+        for (const char *name : field_names)
+        {
+            out << ',' << name;
+        }
+        out << '\n';
+    }
+}
+
+Sudoku_RC_T SudokuTelemetry::Solve(SudokuPuzzle &puzzle, unsigned long index, const SudokuSolveOptions &options)
+{
+    SudokuTelemetryRecord record = {};
+    int8_t values[NUM_ROWS * NUM_COLS];
+
+    (void)puzzle.GetValues(values);
+    for (int8_t v : values)
+    {
+        record.clues += (v > 0) ? 1 : 0;
+    }
+    record.index = index;
+
+    auto start = std::chrono::steady_clock::now();
+    record.rc = puzzle.Solve(options, &record.stats);
+    record.nanoseconds = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    Record(record);
+
+    return record.rc;
+}
+
+void SudokuTelemetry::Record(const SudokuTelemetryRecord &record)
+{
+    const uint64_t values[NUM_FIELDS] = {record.clues, record.stats.solve_calls, record.stats.backtracks,
+                                         record.stats.max_level, record.stats.prune_sweeps, record.nanoseconds};
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (SudokuTelemetryFormat::CSV == format)
+    {
+        out << record.index << ',' << (int)record.rc;
+        for (uint64_t v : values)
+        {
+            out << ',' << v;
+        }
+        out << '\n';
+    }
+    else
+    {
+        out << "{\"index\":" << record.index << ",\"rc\":" << (int)record.rc;
+        for (unsigned int f = 0; f < NUM_FIELDS; f++)
+        {
+            out << ",\"" << field_names[f] << "\":" << values[f];
+        }
+        out << "}\n";
+    }
+
+    count++;
+    for (unsigned int f = 0; f < NUM_FIELDS; f++)
+    {
+        sums[f] += values[f];
+        maxima[f] = (values[f] > maxima[f]) ? values[f] : maxima[f];
+        histograms[f][BucketOf(values[f])]++;
+    }
+}
+
+void SudokuTelemetry::Finish(void)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (unsigned int f = 0; f < NUM_FIELDS; f++)
+    {
+        if (SudokuTelemetryFormat::CSV == format)
+        {
+            out << "# " << field_names[f] << " count=" << count << " sum=" << sums[f] << " max=" << maxima[f] << " buckets=";
+        }
+        else
+        {
+            out << "{\"histogram\":\"" << field_names[f] << "\",\"count\":" << count << ",\"sum\":" << sums[f]
+                << ",\"max\":" << maxima[f] << ",\"buckets\":[";
+        }
+
+        /* Buckets up to the last non-empty one, as [lower bound, count] pairs */
+        unsigned int last = BucketOf(maxima[f]);
+        for (unsigned int b = 0; b <= last; b++)
+        {
+            uint64_t lower = (0 == b) ? 0 : ((uint64_t)1 << (b - 1));
+            if (SudokuTelemetryFormat::CSV == format)
+            {
+                out << ((0 == b) ? "" : " ") << lower << ':' << histograms[f][b];
+            }
+            else
+            {
+                out << ((0 == b) ? "[" : ",[") << lower << ',' << histograms[f][b] << ']';
+            }
+        }
+        out << ((SudokuTelemetryFormat::CSV == format) ? "\n" : "]}\n");
+    }
+    out.flush();
+
+    count = 0;
+    (void)memset(sums, 0, sizeof(sums));
+    (void)memset(maxima, 0, sizeof(maxima));
+    (void)memset(histograms, 0, sizeof(histograms));
+}
+
+unsigned long SudokuTelemetry::Count(void) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return count;
+}
+
+unsigned long SudokuTelemetry::Bucket(Field field, unsigned int bucket) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return ((field < NUM_FIELDS) && (bucket < num_buckets)) ? histograms[field][bucket] : 0;
+}
+
+uint64_t SudokuTelemetry::Sum(Field field) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return (field < NUM_FIELDS) ? sums[field] : 0;
+}
+
+unsigned int SudokuTelemetry::BucketOf(uint64_t value)
+{
+    unsigned int bucket = 0;
+
+    for (; value != 0; value >>= 1)
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+const char *SudokuTelemetry::FieldName(Field field)
+{
+    return (field < NUM_FIELDS) ? field_names[field] : "";
+}
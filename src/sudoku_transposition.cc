@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @brief Lock-free transposition table of search states
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+#include "sudoku_transposition.hh"
+
+SudokuTranspositionTable::SudokuTranspositionTable(unsigned int log2_entries)
+    : mask(((size_t)1 << ((log2_entries < 30) ? log2_entries : 30)) - 1)
+{
+    entries.reset(new Entry[mask + 1]);
+    Clear();
+}
+
+void SudokuTranspositionTable::Clear(void)
+{
+    for (size_t i = 0; i <= mask; i++)
+    {
+        entries[i].check.store(0, std::memory_order_relaxed);
+        entries[i].data.store(0, std::memory_order_relaxed);
+    }
+}
@@ -1,27 +1,243 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <thread>
+
 #include "sudoku.hh"
+#include "sudoku_arena.hh"
+#include "sudoku_store.hh"
+#include "sudoku_stream.hh"
+#include "sudoku_telemetry.hh"
 #include "test-sudoku.hh"
 
 using namespace std;
 
+static const size_t cache_line = 64;
+
+/**
+ * @brief Prefetches the state a search touches in its next step: the puzzle and the frames
+ *        of the current and the previous level.
+ */
+static inline void PrefetchTask(const Sudoku_SolveTask_T &task)
+{
+#if defined(__GNUC__)
+    const char *puzzle = reinterpret_cast<const char *>(task.puzzle);
+    const char *frames = reinterpret_cast<const char *>(&task.ws->frames[(0 != task.level) ? task.level - 1 : 0]);
+
+    for (size_t i = 0; i < sizeof(struct SudokuPuzzle_S); i += cache_line)
+    {
+        __builtin_prefetch(puzzle + i, 1);
+    }
+    for (size_t i = 0; i < 2 * sizeof(Sudoku_SolveFrame_T); i += cache_line)
+    {
+        __builtin_prefetch(frames + i, 1);
+    }
+#else
+    (void)task;
+#endif
+}
+
+size_t Solve_Interleaved(vector<struct SudokuPuzzle_S> &puzzles, unsigned int width, Sudoku_Stats_T &stats, Sudoku_RC_T *rcs)
+{
+    struct Slot
+    {
+        Sudoku_SolveTask_T task;
+        size_t index;
+        bool busy;
+    };
+
+    width = (0 != width) ? width : 1;
+
+    vector<Slot> slots(width);
+    unique_ptr<Sudoku_Workspace_T[]> workspaces(new Sudoku_Workspace_T[width]);
+    size_t next = 0;
+    size_t n_busy = 0;
+    size_t n_solved = 0;
+
+    auto start = [&](Slot &slot)
+    {
+        slot.busy = (next < puzzles.size());
+        if (slot.busy)
+        {
+            slot.index = next++;
+            (void)Sudoku_SolveBegin(&slot.task, &puzzles[slot.index], &workspaces[&slot - slots.data()], nullptr);
+        }
+    };
+
+    stats = {};
+    for (auto &slot : slots)
+    {
+        start(slot);
+        n_busy += slot.busy ? 1 : 0;
+    }
+
+    /* Round-robin, one search node per slot and turn */
+    for (size_t k = 0; 0 != n_busy; k = (k + 1 < width) ? k + 1 : 0)
+    {
+        Slot &slot = slots[k];
+        const Slot &following = slots[(k + 1 < width) ? k + 1 : 0];
+
+        if (following.busy)
+        {
+            PrefetchTask(following.task);
+        }
+        if (!slot.busy)
+        {
+            continue;
+        }
+
+        Sudoku_RC_T rc = Sudoku_SolveStep(&slot.task);
+        if (SUDOKU_RC_PRUNE == rc)
+        {
+            continue;
+        }
+
+        Sudoku_AccumulateStats(&stats, &slot.task.stats);
+        n_solved += (SUDOKU_RC_SUCCESS == rc) ? 1 : 0;
+        if (nullptr != rcs)
+        {
+            rcs[slot.index] = rc;
+        }
+
+        start(slot);
+        n_busy -= slot.busy ? 0 : 1;
+    }
+
+    return n_solved;
+}
+
 tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(string file_name)
 {
+    return Process_File(file_name, SUDOKU_ENGINE_PRUNE);
+}
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(string file_name, Sudoku_Engine_T engine)
+{
+    return Process_File(file_name, [engine](SudokuPuzzle &p)
+                        { return p.Solve(engine); });
+}
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(string file_name, SudokuSolutionStore &store)
+{
+    return Process_File(file_name, [&store](SudokuPuzzle &p)
+                        { return store.Solve(p); });
+}
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(string file_name, SudokuTelemetry &telemetry)
+{
+    unsigned long index = 0;
+
+    auto result = Process_File(file_name, [&telemetry, &index](SudokuPuzzle &p)
+                               { return telemetry.Solve(p, index++); });
+    telemetry.Finish();
+
+    return result;
+}
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(string file_name, const function<Sudoku_RC_T(SudokuPuzzle &)> &solve)
+{
+    static thread_local SudokuArena file_arena;
+
+    return Process_File(file_name, file_arena, solve);
+}
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(const string &file_name, SudokuArena &arena, const function<Sudoku_RC_T(SudokuPuzzle &)> &solve)
+{
+    static const size_t block_size = 64 * 1024;
+
     unsigned int success = 0;
     unsigned int prune = 0;
     unsigned int error = 0;
     unsigned int count = 0;
 
-    ifstream test_data_file;
-    string data_array;
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return make_tuple(success, prune, error, count);
+    }
+
+    arena.Reset();
+    char *block = arena.NewArray<char>(block_size);
+    SudokuPuzzle *p = arena.New<SudokuPuzzle>();
+    size_t filled = 0;
 
-    test_data_file.open(file_name);
-    while (getline(test_data_file, data_array))
+    for (bool eof = false; !eof;)
     {
-        if (81 == data_array.length())
+        ssize_t n = read(fd, block + filled, block_size - filled);
+        eof = (n <= 0);
+        filled += (n > 0) ? (size_t)n : 0;
+
+        /* Complete lines of the block; the last one only at the end of the file */
+        size_t begin = 0;
+        while (begin < filled)
         {
-            SudokuPuzzle p(data_array);
+            const char *end = static_cast<const char *>(memchr(block + begin, '\n', filled - begin));
+            if ((nullptr == end) && !eof)
+            {
+                break;
+            }
+
+            size_t length = (nullptr != end) ? (size_t)(end - block) - begin : filled - begin;
+            if (81 == length)
+            {
+                (void)p->InitializePuzzle(block + begin);
+
+                auto rc = solve(*p);
+                switch (rc)
+                {
+                case SUDOKU_RC_SUCCESS:
+                    success++;
+                    break;
+                case SUDOKU_RC_PRUNE:
+                    prune++;
+                    break;
+                default:
+                    error++;
+                }
+                count++;
+            }
+            begin += length + 1;
+        }
+
+        begin = min(begin, filled);
+        (void)memmove(block, block + begin, filled - begin);
+        filled -= begin;
+
+        /* A line filling the whole block is no puzzle, drop it */
+        filled = (block_size == filled) ? 0 : filled;
+    }
+    (void)close(fd);
+
+    return make_tuple(success, prune, error, count);
+}
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_Binary_File(string file_name)
+{
+    unsigned int success = 0;
+    unsigned int prune = 0;
+    unsigned int error = 0;
+    unsigned int count = 0;
+
+    ifstream test_data_file(file_name, ios::binary);
+    vector<uint8_t> data((istreambuf_iterator<char>(test_data_file)), istreambuf_iterator<char>());
+    Sudoku_Dataset_T dataset;
+
+    if (SUDOKU_RC_SUCCESS == Sudoku_Dataset_Open(&dataset, data.data(), data.size()))
+    {
+        SudokuPuzzle p;
+
+        for (uint64_t i = 0; i < dataset.count; i++)
+        {
+            (void)p.InitializePuzzle(dataset, i);
 
             auto rc = p.Solve();
             switch (rc)
@@ -38,7 +254,66 @@ tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_File(strin
             count++;
         }
     }
-    test_data_file.close();
 
     return make_tuple(success, prune, error, count);
 }
+
+tuple<unsigned int, unsigned int, unsigned int, unsigned int> Process_Compressed_File(string file_name, unsigned int n_workers)
+{
+    atomic<unsigned int> success(0);
+    atomic<unsigned int> prune(0);
+    atomic<unsigned int> error(0);
+    atomic<unsigned int> count(0);
+
+    SudokuPuzzleStream stream;
+    if (SUDOKU_RC_SUCCESS != stream.Open(file_name))
+    {
+        return make_tuple(0, 0, 0, 0);
+    }
+
+    auto worker = [&]()
+    {
+        vector<string> batch;
+
+        while (stream.Next(batch))
+        {
+            for (auto &data_array : batch)
+            {
+                SudokuPuzzle p(data_array);
+
+                auto rc = p.Solve();
+                switch (rc)
+                {
+                case SUDOKU_RC_SUCCESS:
+                    success++;
+                    break;
+                case SUDOKU_RC_PRUNE:
+                    prune++;
+                    break;
+                default:
+                    error++;
+                }
+                count++;
+            }
+        }
+    };
+
+    vector<thread> workers;
+    for (unsigned int i = 1; i < n_workers; i++)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &w : workers)
+    {
+        w.join();
+    }
+
+    /* A corrupt or truncated file counts as one error */
+    if (SUDOKU_RC_SUCCESS != stream.Status())
+    {
+        error++;
+    }
+
+    return make_tuple(success.load(), prune.load(), error.load(), count.load());
+}
@@ -5,6 +5,14 @@
 #include <array>
 #include <vector>
 #include <tuple>
+#include <functional>
+
+#include "sudoku.h"
+
+class SudokuArena;
+class SudokuPuzzle;
+class SudokuSolutionStore;
+class SudokuTelemetry;
 
 const std::vector<std::string> validTestPuzzles = {
     "974236158638591742125487936316754289742918563589362417867125394253649871491873625", /* Already solved puzzle */
@@ -38,5 +46,31 @@ const std::vector<std::string> testFileNames = {
 };
 
 std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_File(std::string file_name);
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_File(std::string file_name, Sudoku_Engine_T engine);
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_File(std::string file_name, SudokuSolutionStore &store);
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_File(std::string file_name, SudokuTelemetry &telemetry);
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_Binary_File(std::string file_name);
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_Compressed_File(std::string file_name, unsigned int n_workers);
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_File(std::string file_name, const std::function<Sudoku_RC_T(SudokuPuzzle &)> &solve);
+
+/**
+ * @brief Solves the puzzles of a text dataset with @p solve, reading and parsing them in @p arena.
+ *
+ * The arena is reset first and then holds the read buffer and the puzzle every line is parsed
+ * into, so once it has grown a file is processed without calling the global allocator.
+ *
+ * @return Number of puzzles solved, pruned and failed, and the number of puzzles.
+ */
+std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>Process_File(const std::string &file_name, SudokuArena &arena, const std::function<Sudoku_RC_T(SudokuPuzzle &)> &solve);
+
+/**
+ * @brief Solves puzzles with @p width resumable searches (Sudoku_SolveStep()) stepped round-robin on one thread.
+ *
+ * The state of the next search is prefetched before each step. Used to measure whether interleaving hides
+ * memory latency; every puzzle gets the same search and result as Sudoku_Solve().
+ *
+ * @return Number of puzzles solved. @p stats holds the statistics summed over the puzzles, @p rcs (optional) the result codes.
+ */
+size_t Solve_Interleaved(std::vector<struct SudokuPuzzle_S> &puzzles, unsigned int width, Sudoku_Stats_T &stats, Sudoku_RC_T *rcs = nullptr);
 
 #endif // TEST_SUDOKU_HH_INCLUDED
\ No newline at end of file
@@ -5,6 +5,12 @@
 #include "test-sudoku.hh"
 
 #include "sudoku.c"
+#include "sudoku_kernels.c"
+#include "sudoku_dlx.c"
+#include "sudoku_backjump.c"
+#include "sudoku_propagate.c"
+#include "sudoku_dataset.c"
+#include "sudoku_heuristic.c"
 
 TEST_CASE("Initialize Puzzle")
 {
@@ -79,6 +85,48 @@ TEST_CASE("Get Value")
             }
         }
     }
+    SUBCASE("Mask to value")
+    {
+        CHECK(SUDOKU_NO_VALUE == Sudoku_MaskToValue(SUDOKU_MASK_NONE));
+        CHECK(SUDOKU_NOT_EXCLUSIVE_VALUE == Sudoku_MaskToValue(SUDOKU_BIT_VALUE_1 | SUDOKU_BIT_VALUE_9));
+        CHECK(SUDOKU_VALUE_1 == Sudoku_MaskToValue(SUDOKU_BIT_VALUE_1));
+        CHECK(SUDOKU_VALUE_9 == Sudoku_MaskToValue(SUDOKU_BIT_VALUE_9));
+    }
+}
+
+TEST_CASE("Bulk accessors")
+{
+    struct SudokuPuzzle_S p;
+    int8_t values[NUM_ROWS * NUM_COLS];
+    uint32_t masks[NUM_ROWS * NUM_COLS];
+
+    (void)Sudoku_InitializeFromArray(&p, validTestPuzzles[3].c_str());
+    (void)Sudoku_PrunePuzzle(&p);
+
+    SUBCASE("NULL Pointer Test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_GetValues(NULL, values));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_GetValues(&p, NULL));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_GetCandidateMasks(NULL, masks));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_GetCandidateMasks(&p, NULL));
+        CHECK(NULL == Sudoku_GetGrid(NULL));
+    }
+    SUBCASE("Values, masks and grid")
+    {
+        const struct SudokuCell_S *grid = Sudoku_GetGrid(&p);
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_GetValues(&p, values));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_GetCandidateMasks(&p, masks));
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                CHECK(Sudoku_GetValue(&p, row, col) == values[row * NUM_COLS + col]);
+                CHECK(p.grid[row][col].candidates == masks[row * NUM_COLS + col]);
+                CHECK(&p.grid[row][col] == &grid[row * NUM_COLS + col]);
+            }
+        }
+    }
 }
 
 TEST_CASE("Test Initialize from Array")
@@ -187,6 +235,92 @@ TEST_CASE("Check Puzzle")
     }
 }
 
+TEST_CASE("Pruned Status")
+{
+    struct SudokuPuzzle_S p;
+
+    CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_GetStatus(NULL));
+
+    SUBCASE("Status Matches Full Check")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            Sudoku_RC_T rc = Sudoku_PrunePuzzle(&p);
+            CHECK(rc == Sudoku_GetStatus(&p));
+            CHECK(rc == Sudoku_Check(&p));
+        }
+    }
+    SUBCASE("Invalid Cases")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_ERROR == Sudoku_PrunePuzzle(&p));
+            CHECK(SUDOKU_RC_ERROR == Sudoku_GetStatus(&p));
+        }
+    }
+    SUBCASE("Invalid Value")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, validTestPuzzles[1].c_str()));
+        CHECK(SUDOKU_RC_INVALID_VALUE == Sudoku_SetValue(&p, 0, 0, 10));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_PrunePuzzle(&p));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_GetStatus(&p));
+    }
+}
+
+TEST_CASE("Zobrist Hash")
+{
+    struct SudokuPuzzle_S p;
+    struct SudokuPuzzle_S q;
+
+    CHECK(0 == Sudoku_GetHash(NULL));
+    CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+    CHECK(0 == Sudoku_GetHash(&p));
+
+    SUBCASE("Independent of Placement Order")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&q));
+        (void)Sudoku_SetValue(&p, 0, 0, 5);
+        (void)Sudoku_SetValue(&p, 4, 7, 2);
+        (void)Sudoku_SetValue(&q, 4, 7, 2);
+        (void)Sudoku_SetValueUsingBitmask(&q, 0, 0, SUDOKU_BIT_VALUE_5);
+        CHECK(0 != Sudoku_GetHash(&p));
+        CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+
+        (void)Sudoku_SetValue(&q, 0, 0, 6);
+        CHECK(Sudoku_GetHash(&p) != Sudoku_GetHash(&q));
+        (void)Sudoku_SetValue(&q, 0, 0, 5);
+        CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+
+        (void)Sudoku_SetValue(&p, 0, 0, 0);
+        (void)Sudoku_SetValue(&p, 4, 7, 0);
+        CHECK(0 == Sudoku_GetHash(&p));
+    }
+    SUBCASE("Values Placed by Pruning")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            char values[NUM_ROWS * NUM_COLS];
+
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            (void)Sudoku_PrunePuzzle(&p);
+            for (unsigned int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+            {
+                values[i] = (char)('0' + Sudoku_GetValue(&p, i / NUM_COLS, i % NUM_COLS));
+            }
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, values));
+            CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+        }
+    }
+    SUBCASE("Invalid Values")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        (void)Sudoku_SetValue(&p, 2, 2, 10);
+        CHECK(0 == Sudoku_GetHash(&p));
+    }
+}
+
 TEST_CASE("Generate Row Mask")
 {
     struct SudokuPuzzle_S p;
@@ -511,4 +645,853 @@ TEST_CASE("Select candidate with lowest amount")
     CHECK((Sudoku_Row_Index_T)4 == row);
     CHECK((Sudoku_Column_Index_T)4 == col);
     CHECK(SUDOKU_BIT_VALUE_2 == val);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Select candidate using search configuration")
+{
+    struct SudokuPuzzle_S p;
+    Sudoku_Row_Index_T row = 0;
+    Sudoku_Column_Index_T col = 0;
+    Sudoku_SearchConfig_T config = {SUDOKU_SCORE_MRV, SUDOKU_ORDER_ASCENDING, 0, NULL};
+
+    CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+    (void)removeCandidate(&p, 6, 2, SUDOKU_MASK_1 | SUDOKU_MASK_2);
+
+    SUBCASE("Minimum remaining values")
+    {
+        CHECK(SUDOKU_BIT_VALUE_3 == Sudoku_SelectCandidateUsingConfig(&p, &config, NULL, &row, &col));
+        CHECK((Sudoku_Row_Index_T)6 == row);
+        CHECK((Sudoku_Column_Index_T)2 == col);
+    }
+    SUBCASE("Default configuration matches Sudoku_SelectCandidate")
+    {
+        Sudoku_Row_Index_T ref_row = 0;
+        Sudoku_Column_Index_T ref_col = 0;
+        CHECK(Sudoku_SelectCandidate(&p, &ref_row, &ref_col) == Sudoku_SelectCandidateUsingConfig(&p, NULL, NULL, &row, &col));
+        CHECK(ref_row == row);
+        CHECK(ref_col == col);
+    }
+    SUBCASE("Seeded tie-breaking is reproducible")
+    {
+        uint32_t rng_a = 1234;
+        uint32_t rng_b = 1234;
+        config.seed = 1234;
+        (void)Sudoku_InitializePuzzle(&p);
+
+        for (int i = 0; i < 10; i++)
+        {
+            Sudoku_Row_Index_T row_b = 0;
+            Sudoku_Column_Index_T col_b = 0;
+            CHECK(Sudoku_SelectCandidateUsingConfig(&p, &config, &rng_a, &row, &col) == Sudoku_SelectCandidateUsingConfig(&p, &config, &rng_b, &row_b, &col_b));
+            CHECK(row == row_b);
+            CHECK(col == col_b);
+        }
+    }
+}
+
+TEST_CASE("Select candidate using heuristic")
+{
+    struct SudokuPuzzle_S p;
+    Sudoku_Row_Index_T row = 0;
+    Sudoku_Column_Index_T col = 0;
+
+    CHECK(NULL == Sudoku_FindHeuristic(NULL));
+    CHECK(NULL == Sudoku_FindHeuristic("none"));
+    CHECK(&Sudoku_Heuristics[0] == Sudoku_FindHeuristic("weighted"));
+    CHECK(SUDOKU_BIT_INVALID_VALUE == Sudoku_SelectCandidateUsingHeuristic(NULL, NULL, &row, &col));
+
+    SUBCASE("Weighted heuristic matches Sudoku_SelectCandidate")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            Sudoku_Row_Index_T ref_row = 0;
+            Sudoku_Column_Index_T ref_col = 0;
+
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            (void)Sudoku_PrunePuzzle(&p);
+            CHECK(Sudoku_SelectCandidate(&p, &ref_row, &ref_col) == Sudoku_SelectCandidateUsingHeuristic(&p, NULL, &row, &col));
+            CHECK(ref_row == row);
+            CHECK(ref_col == col);
+        }
+    }
+    SUBCASE("Selection summary")
+    {
+        Sudoku_Selection_T sel;
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, validTestPuzzles[3].c_str()));
+        (void)Sudoku_PrunePuzzle(&p);
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_PrepareSelection(&p, &sel));
+        CHECK(0 < sel.n_cells);
+
+        unsigned int n_cell_values = 0;
+        unsigned int n_values = 0;
+        unsigned int n_unit_values = 0;
+        for (unsigned int i = 0; i < sel.n_cells; i++)
+        {
+            CHECK(sel.cells[i].n_candidates == Sudoku_KernelCount(sel.cells[i].candidates));
+            CHECK(sel.cells[i].n_row_empty == Sudoku_KernelCount(p.row_candidates[sel.cells[i].row]));
+            n_cell_values += sel.cells[i].n_candidates;
+        }
+        for (unsigned int v = 0; v < NUM_CANDIDATES; v++)
+        {
+            n_values += sel.value_counts[v];
+            for (unsigned int u = 0; u < 27; u++)
+            {
+                n_unit_values += sel.unit_value_counts[u][v];
+            }
+        }
+        CHECK(n_cell_values == n_values);
+        CHECK(3 * n_values == n_unit_values);
+    }
+    SUBCASE("Least constraining value")
+    {
+        (void)Sudoku_InitializePuzzle(&p);
+        /* Value 9 is removed from the peers of cell (0, 0), value 1 only from the cell itself */
+        for (unsigned int i = 1; i < NUM_COLS; i++)
+        {
+            (void)removeCandidate(&p, 0, i, SUDOKU_MASK_9);
+            (void)removeCandidate(&p, i, 0, SUDOKU_MASK_9);
+        }
+        (void)removeCandidate(&p, 0, 0, SUDOKU_MASK_ALL & ~(SUDOKU_MASK_1 | SUDOKU_MASK_9));
+
+        CHECK(SUDOKU_BIT_VALUE_9 == Sudoku_SelectCandidateUsingHeuristic(&p, Sudoku_FindHeuristic("mrv-lcv"), &row, &col));
+        CHECK((Sudoku_Row_Index_T)0 == row);
+        CHECK((Sudoku_Column_Index_T)0 == col);
+        CHECK(SUDOKU_BIT_VALUE_1 == Sudoku_SelectCandidateUsingHeuristic(&p, Sudoku_FindHeuristic("mrv"), &row, &col));
+    }
+    SUBCASE("Configurations select the built-in functions")
+    {
+        Sudoku_SearchConfig_T config = {SUDOKU_SCORE_MRV, SUDOKU_ORDER_ASCENDING, 0, NULL};
+        Sudoku_Selection_T sel;
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, validTestPuzzles[3].c_str()));
+        (void)Sudoku_PrunePuzzle(&p);
+        (void)Sudoku_PrepareSelection(&p, &sel);
+
+        for (unsigned int i = 0; i < sel.n_cells; i++)
+        {
+            const Sudoku_CellInfo_T *cell = &sel.cells[i];
+
+            CHECK(Sudoku_ScoreWeighted(&sel, cell) == Sudoku_BranchScores[SUDOKU_SCORE_WEIGHTED](&sel, cell, NULL));
+            CHECK(cell->n_candidates + cell->n_row_empty + cell->n_col_empty + cell->n_sub_empty == Sudoku_BranchScores[SUDOKU_SCORE_UNITS](&sel, cell, NULL));
+            CHECK(NUM_ROWS * NUM_COLS - sel.value_counts[0] == Sudoku_ValueOrders[SUDOKU_ORDER_MOST_FREQUENT](&sel, cell, 0, NULL));
+        }
+
+        Sudoku_Row_Index_T ref_row = 0;
+        Sudoku_Column_Index_T ref_col = 0;
+        CHECK(Sudoku_SelectCandidateUsingHeuristic(&p, Sudoku_FindHeuristic("mrv"), &ref_row, &ref_col) ==
+              Sudoku_SelectCandidateUsingConfig(&p, &config, NULL, &row, &col));
+        CHECK(ref_row == row);
+        CHECK(ref_col == col);
+    }
+    SUBCASE("Seeded ties with a heuristic table")
+    {
+        Sudoku_SearchConfig_T config = {SUDOKU_SCORE_MRV, SUDOKU_ORDER_ASCENDING, 1234, NULL};
+        Sudoku_SearchConfig_T table_config = {SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 1234, Sudoku_FindHeuristic("mrv")};
+        uint32_t rng_a = 1234;
+        uint32_t rng_b = 1234;
+        bool first_only = true;
+
+        (void)Sudoku_InitializePuzzle(&p);
+        for (int i = 0; i < 10; i++)
+        {
+            Sudoku_Row_Index_T row_b = 0;
+            Sudoku_Column_Index_T col_b = 0;
+
+            CHECK(Sudoku_SelectCandidateUsingConfig(&p, &config, &rng_a, &row, &col) ==
+                  Sudoku_SelectCandidateUsingConfig(&p, &table_config, &rng_b, &row_b, &col_b));
+            CHECK(row == row_b);
+            CHECK(col == col_b);
+            first_only = first_only && (0 == row) && (0 == col);
+        }
+        CHECK(!first_only);
+    }
+}
+
+TEST_CASE("Candidate mask kernels")
+{
+    struct SudokuKernels_S selected = Sudoku_Kernels;
+    uint32_t mask;
+
+    Sudoku_SelectPortableKernels();
+    CHECK(SUDOKU_KERNEL_PORTABLE == Sudoku_Kernels.features);
+
+    for (mask = 0; mask <= SUDOKU_MASK_ALL; mask++)
+    {
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < NUM_CANDIDATES; i++)
+        {
+            count += (mask >> i) & 1;
+        }
+
+        CHECK(count == Sudoku_Kernels.count(mask));
+        CHECK(count == selected.count(mask));
+
+        if (mask != 0)
+        {
+            CHECK(Sudoku_Kernels.lowest(mask) == selected.lowest(mask));
+            CHECK((mask & (1u << Sudoku_Kernels.lowest(mask))) != 0);
+            CHECK((mask & ((1u << Sudoku_Kernels.lowest(mask)) - 1)) == 0);
+        }
+    }
+
+    CHECK(32 == Sudoku_Kernels.count(SUDOKU_MASK_INVALID));
+
+    CHECK(SUDOKU_NO_VALUE == convertMaskToValue(SUDOKU_MASK_NONE));
+    CHECK(SUDOKU_VALUE_9 == convertMaskToValue(SUDOKU_MASK_9));
+    CHECK(SUDOKU_NOT_EXCLUSIVE_VALUE == convertMaskToValue(SUDOKU_MASK_1 | SUDOKU_MASK_2));
+    CHECK(SUDOKU_NOT_EXCLUSIVE_VALUE == convertMaskToValue(SUDOKU_MASK_INVALID));
+
+    Sudoku_SelectKernels();
+    CHECK(selected.features == Sudoku_Kernels.features);
+}
+
+TEST_CASE("Dancing Links exact cover")
+{
+    static struct SudokuDLX_S dlx;
+    struct SudokuPuzzle_S p;
+
+    SUBCASE("NULL Pointer test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_DLX_Solve(NULL, &p, 1));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_DLX_Solve(&dlx, NULL, 1));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_DLX_StoreSolution(&dlx, NULL));
+    }
+    SUBCASE("Solve and store")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, validTestPuzzles[3].c_str()));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_Solve(&dlx, &p, 2));
+        CHECK(1 == dlx.n_solutions);
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_Check(&p));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_StoreSolution(&dlx, &p));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&p));
+    }
+    SUBCASE("Candidate masks restrict the matrix")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        (void)removeCandidate(&p, 0, 0, SUDOKU_MASK_ALL);
+        CHECK(SUDOKU_RC_ERROR == Sudoku_DLX_Solve(&dlx, &p, 1));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_DLX_StoreSolution(&dlx, &p));
+    }
+    SUBCASE("Conflicting givens")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_ERROR == Sudoku_DLX_Solve(&dlx, &p, 1));
+        }
+    }
+}
+
+TEST_CASE("Conflict-directed backjumping")
+{
+    static struct SudokuBackjump_S bj;
+    static struct SudokuDLX_S dlx;
+    struct SudokuPuzzle_S p;
+    struct SudokuPuzzle_S q;
+
+    CHECK(1 == decisionBit(1));
+    CHECK(((Sudoku_Decisions_T)1 << 63) == decisionBit(64));
+    CHECK(((Sudoku_Decisions_T)1 << 63) == decisionBit(81));
+
+    SUBCASE("NULL Pointer test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_Backjump_Solve(NULL, &p, NULL));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_Backjump_Solve(&bj, NULL, NULL));
+    }
+    SUBCASE("Same solutions as the pruning engine")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Backjump_Solve(&bj, &p, NULL));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&p));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_Solve(&dlx, &q, 1));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_StoreSolution(&dlx, &q));
+            CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+            CHECK(bj.n_levels_skipped >= bj.n_backjumps);
+        }
+    }
+    SUBCASE("Reasons of propagated deductions")
+    {
+        uint8_t queue[NUM_ROWS * NUM_COLS];
+        unsigned int n_queue = 0;
+        Sudoku_Decisions_T conflict = 0;
+        struct SudokuBackjumpState_S *s = &bj.states[0];
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&s->puzzle));
+        (void)memset(s->value_reason, 0, sizeof(s->value_reason));
+        (void)memset(s->elim_reason, 0, sizeof(s->elim_reason));
+
+        /* Values 1-8 in row 0 by decisions 1-8 leave value 9 as naked single of cell (0, 8) */
+        for (unsigned int col = 0; col < 8; col++)
+        {
+            assignValue(s, col, 1u << col, decisionBit(col + 1), queue, &n_queue);
+        }
+        CHECK(SUDOKU_RC_SUCCESS == propagate(s, queue, n_queue, &conflict));
+        CHECK(SUDOKU_MASK_9 == s->puzzle.grid[0][8].value);
+        CHECK(0xFF == s->value_reason[8]);
+        CHECK(9 == s->puzzle.n_filled);
+
+        /* Value 9 in column 8 by decision 9 conflicts with the single */
+        n_queue = 0;
+        assignValue(s, 8 * NUM_COLS + 8, SUDOKU_MASK_9, decisionBit(9), queue, &n_queue);
+        CHECK(SUDOKU_RC_ERROR == propagate(s, queue, n_queue, &conflict));
+        CHECK(0x1FF == conflict);
+    }
+    SUBCASE("Conflicting givens")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_ERROR == Sudoku_Backjump_Solve(&bj, &p, NULL));
+        }
+    }
+}
+
+static int cancelAfter(void *user)
+{
+    unsigned int *polls = (unsigned int *)user;
+    return (0 == (*polls)--) ? 1 : 0;
+}
+
+TEST_CASE("Reentrant solve")
+{
+    static Sudoku_Workspace_T ws;
+    static struct SudokuDLX_S dlx;
+    struct SudokuPuzzle_S p;
+    struct SudokuPuzzle_S q;
+    Sudoku_Stats_T stats;
+
+    SUBCASE("NULL Pointer test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_Solve(NULL, &ws, NULL, NULL));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_Solve(&p, NULL, NULL, NULL));
+    }
+    SUBCASE("Same solutions as Dancing Links")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&p, &ws, NULL, &stats));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&p));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_Solve(&dlx, &q, 1));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_StoreSolution(&dlx, &q));
+            CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+            CHECK(0 < stats.solve_calls);
+            CHECK(stats.backtracks < stats.solve_calls);
+            CHECK(stats.max_level < stats.solve_calls);
+        }
+    }
+    SUBCASE("Node budget and cancellation")
+    {
+        Sudoku_SolveOptions_T options = {{SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL}, 1, NULL, NULL, SUDOKU_PROPAGATE_SINGLES, 0};
+        unsigned int polls = 0;
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        CHECK(SUDOKU_RC_BUDGET_EXHAUSTED == Sudoku_Solve(&p, &ws, &options, &stats));
+        CHECK(1 == stats.solve_calls);
+        CHECK(0 == p.n_filled);
+
+        options.max_nodes = 0;
+        options.cancel = cancelAfter;
+        options.user = &polls;
+        CHECK(SUDOKU_RC_CANCELLED == Sudoku_Solve(&p, &ws, &options, &stats));
+        CHECK(0 == stats.solve_calls);
+
+        polls = 3;
+        CHECK(SUDOKU_RC_CANCELLED == Sudoku_Solve(&p, &ws, &options, &stats));
+        CHECK(3 == stats.solve_calls);
+        CHECK(0 == p.n_filled);
+    }
+    SUBCASE("Accumulated statistics")
+    {
+        Sudoku_Stats_T total = {};
+        unsigned int max_level = 0;
+        unsigned int solve_calls = 0;
+        unsigned int backtracks = 0;
+
+        for (auto x : validTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&p, &ws, NULL, &stats));
+            Sudoku_AccumulateStats(&total, &stats);
+            max_level = (stats.max_level > max_level) ? stats.max_level : max_level;
+            solve_calls += stats.solve_calls;
+            backtracks += stats.backtracks;
+        }
+        CHECK(max_level == total.max_level);
+        CHECK(solve_calls == total.solve_calls);
+        CHECK(backtracks == total.backtracks);
+
+        Sudoku_PropagationStats_T deductions = {1, 2, 3, 4, 5, 6};
+        Sudoku_AccumulatePropagationStats(&total.propagation, &deductions);
+        Sudoku_AccumulatePropagationStats(&total.propagation, &deductions);
+        CHECK(2 == total.propagation.hidden_singles);
+        CHECK(12 == total.propagation.probe_eliminations);
+    }
+    SUBCASE("Heuristic of the search configuration")
+    {
+        Sudoku_SolveOptions_T options = {{SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL}, 0, NULL, NULL, SUDOKU_PROPAGATE_SINGLES, 0};
+        Sudoku_Stats_T ref_stats;
+
+        for (auto x : validTestPuzzles)
+        {
+            /* The weighted heuristic takes the decisions of the default configuration */
+            options.config.heuristic = Sudoku_FindHeuristic("weighted");
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&p, &ws, &options, &stats));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&q, &ws, NULL, &ref_stats));
+            CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+            CHECK(ref_stats.solve_calls == stats.solve_calls);
+
+            options.config.heuristic = Sudoku_FindHeuristic("mrv-lcv");
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&p, &ws, &options, &stats));
+            CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+        }
+
+        options.max_nodes = 1;
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        CHECK(SUDOKU_RC_BUDGET_EXHAUSTED == Sudoku_Solve(&p, &ws, &options, &stats));
+        CHECK(1 == stats.solve_calls);
+    }
+    SUBCASE("Conflicting givens")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_ERROR == Sudoku_Solve(&p, &ws, NULL, &stats));
+        }
+    }
+}
+
+TEST_CASE("Propagation levels")
+{
+    static Sudoku_Workspace_T ws;
+    static struct SudokuDLX_S dlx;
+    struct SudokuPuzzle_S p;
+    struct SudokuPuzzle_S q;
+    Sudoku_PropagationStats_T counters;
+    Sudoku_Stats_T stats;
+
+    SUBCASE("NULL Pointer test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_PropagatePuzzle(NULL, SUDOKU_PROPAGATE_FISH, &counters));
+    }
+    SUBCASE("Same solutions at every level")
+    {
+        for (auto level : {SUDOKU_PROPAGATE_SINGLES, SUDOKU_PROPAGATE_HIDDEN, SUDOKU_PROPAGATE_LOCKED, SUDOKU_PROPAGATE_SUBSETS, SUDOKU_PROPAGATE_FISH})
+        {
+            Sudoku_SolveOptions_T options = {{SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL}, 0, NULL, NULL, level, 0};
+
+            for (auto x : validTestPuzzles)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, x.c_str()));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&p, &ws, &options, &stats));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&p));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_Solve(&dlx, &q, 1));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_StoreSolution(&dlx, &q));
+                CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+            }
+            for (auto x : invalidTestPuzzles)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+                CHECK(SUDOKU_RC_ERROR == Sudoku_Solve(&p, &ws, &options, &stats));
+            }
+        }
+    }
+    SUBCASE("Hidden single")
+    {
+        /* 1 is left in the first cell of the first row only */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (Sudoku_Column_Index_T col = 1; col < NUM_COLS; col++)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, 0, col, SUDOKU_BIT_VALUE_1));
+        }
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&q, SUDOKU_PROPAGATE_SINGLES, &counters));
+        CHECK(0 == Sudoku_GetValue(&q, 0, 0));
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_HIDDEN, &counters));
+        CHECK(1 == Sudoku_GetValue(&p, 0, 0));
+        CHECK(1 == counters.hidden_singles);
+        CHECK(0 == (p.grid[5][0].candidates & SUDOKU_MASK_1));
+    }
+    SUBCASE("Value without a place")
+    {
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, 4, col, SUDOKU_BIT_VALUE_9));
+        }
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&q, SUDOKU_PROPAGATE_SINGLES, &counters));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_HIDDEN, &counters));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_GetStatus(&p));
+    }
+    SUBCASE("Pointing")
+    {
+        /* 1 of the first subgrid is confined to the first row */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (Sudoku_Row_Index_T row = 1; row < 3; row++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < 3; col++)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, row, col, SUDOKU_BIT_VALUE_1));
+            }
+        }
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&q, SUDOKU_PROPAGATE_HIDDEN, &counters));
+        CHECK(0 != (q.grid[0][5].candidates & SUDOKU_MASK_1));
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_LOCKED, &counters));
+        CHECK(6 == counters.locked_eliminations);
+        CHECK(0 == (p.grid[0][5].candidates & SUDOKU_MASK_1));
+        CHECK(0 != (p.grid[1][5].candidates & SUDOKU_MASK_1));
+    }
+    SUBCASE("Claiming")
+    {
+        /* 1 of the fifth column is confined to the middle subgrid */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (Sudoku_Row_Index_T row = 0; row < NUM_ROWS; row++)
+        {
+            if ((row / 3) != 1)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, row, 4, SUDOKU_BIT_VALUE_1));
+            }
+        }
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_LOCKED, &counters));
+        CHECK(6 == counters.locked_eliminations);
+        CHECK(0 == (p.grid[4][3].candidates & SUDOKU_MASK_1));
+        CHECK(0 != (p.grid[4][4].candidates & SUDOKU_MASK_1));
+        CHECK(0 != (p.grid[4][6].candidates & SUDOKU_MASK_1));
+    }
+    SUBCASE("Naked pair")
+    {
+        /* The first two cells of the first row hold 1 and 2 only */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        p.grid[0][0].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_2;
+        p.grid[0][1].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_2;
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&q, SUDOKU_PROPAGATE_LOCKED, &counters));
+        CHECK(0 == counters.locked_eliminations);
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_SUBSETS, &counters));
+        CHECK(26 == counters.subset_eliminations);
+        CHECK(0 == (p.grid[0][8].candidates & (SUDOKU_MASK_1 | SUDOKU_MASK_2)));
+        CHECK(0 == (p.grid[2][2].candidates & (SUDOKU_MASK_1 | SUDOKU_MASK_2)));
+        CHECK(0 != (p.grid[2][3].candidates & SUDOKU_MASK_1));
+    }
+    SUBCASE("Hidden pair")
+    {
+        /* 1 and 2 of the fifth row are confined to its last two cells */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (Sudoku_Column_Index_T col = 0; col < 7; col++)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, 4, col, SUDOKU_BIT_VALUE_1));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, 4, col, SUDOKU_BIT_VALUE_2));
+        }
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&q, SUDOKU_PROPAGATE_LOCKED, &counters));
+        CHECK(SUDOKU_MASK_ALL == q.grid[4][8].candidates);
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_SUBSETS, &counters));
+        CHECK(14 == counters.subset_eliminations);
+        CHECK((SUDOKU_MASK_1 | SUDOKU_MASK_2) == p.grid[4][7].candidates);
+        CHECK((SUDOKU_MASK_1 | SUDOKU_MASK_2) == p.grid[4][8].candidates);
+    }
+    SUBCASE("X-Wing")
+    {
+        /* 1 of the first and fifth rows is confined to the first and fifth columns */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (Sudoku_Row_Index_T row : {0, 4})
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                if ((0 != col) && (4 != col))
+                {
+                    CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, row, col, SUDOKU_BIT_VALUE_1));
+                }
+            }
+        }
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&q, SUDOKU_PROPAGATE_SUBSETS, &counters));
+        CHECK(0 != (q.grid[2][0].candidates & SUDOKU_MASK_1));
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_FISH, &counters));
+        CHECK(14 == counters.fish_eliminations);
+        CHECK(0 == (p.grid[2][0].candidates & SUDOKU_MASK_1));
+        CHECK(0 == (p.grid[8][4].candidates & SUDOKU_MASK_1));
+        CHECK(0 != (p.grid[2][1].candidates & SUDOKU_MASK_1));
+    }
+    SUBCASE("Swordfish")
+    {
+        /* 1 of rows 1, 4 and 7 is confined to columns 1, 4 and 7, two cells per row */
+        const Sudoku_Column_Index_T keep[3][2] = {{0, 3}, {3, 6}, {0, 6}};
+
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        for (unsigned int i = 0; i < 3; i++)
+        {
+            for (Sudoku_Column_Index_T col = 0; col < NUM_COLS; col++)
+            {
+                if ((keep[i][0] != col) && (keep[i][1] != col))
+                {
+                    CHECK(SUDOKU_RC_SUCCESS == Sudoku_RemoveCandidate(&p, 3 * i, col, SUDOKU_BIT_VALUE_1));
+                }
+            }
+        }
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_PropagatePuzzle(&p, SUDOKU_PROPAGATE_FISH, &counters));
+        CHECK(18 == counters.fish_eliminations);
+        CHECK(0 == (p.grid[1][0].candidates & SUDOKU_MASK_1));
+        CHECK(0 == (p.grid[8][6].candidates & SUDOKU_MASK_1));
+        CHECK(0 != (p.grid[1][1].candidates & SUDOKU_MASK_1));
+    }
+}
+
+TEST_CASE("Failed-candidate probing")
+{
+    static Sudoku_Workspace_T ws;
+    static struct SudokuDLX_S dlx;
+    struct SudokuPuzzle_S p;
+    struct SudokuPuzzle_S q;
+    Sudoku_PropagationStats_T counters;
+    Sudoku_Stats_T stats;
+
+    SUBCASE("NULL Pointer test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_ProbePuzzle(NULL, SUDOKU_PROPAGATE_SINGLES, 16, &counters));
+    }
+    SUBCASE("Same solutions with probing")
+    {
+        Sudoku_SolveOptions_T options = {{SUDOKU_SCORE_WEIGHTED, SUDOKU_ORDER_LEAST_FREQUENT, 0, NULL}, 0, NULL, NULL, SUDOKU_PROPAGATE_SINGLES, 16};
+
+        for (auto x : validTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&q, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Solve(&p, &ws, &options, &stats));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_Solve(&dlx, &q, 1));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_StoreSolution(&dlx, &q));
+            CHECK(Sudoku_GetHash(&p) == Sudoku_GetHash(&q));
+        }
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_ERROR == Sudoku_Solve(&p, &ws, &options, &stats));
+        }
+    }
+    SUBCASE("Failed candidate")
+    {
+        /* 1 in the first cell leaves 3 for both of the next two cells */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        p.grid[0][0].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_2;
+        p.grid[0][1].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_3;
+        p.grid[0][2].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_3;
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_ProbePuzzle(&q, SUDOKU_PROPAGATE_SINGLES, 0, &counters));
+        CHECK(0 == Sudoku_GetValue(&q, 0, 0));
+        CHECK(0 == counters.probes);
+
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_ProbePuzzle(&q, SUDOKU_PROPAGATE_SINGLES, 1, &counters));
+        CHECK(2 == Sudoku_GetValue(&q, 0, 0));
+        CHECK(1 == counters.probes);
+        CHECK(1 == counters.probe_eliminations);
+    }
+    SUBCASE("Eliminations common to both candidates")
+    {
+        /* Either way, 1 and 3 of the first row go to its second and third cells */
+        counters = {};
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        p.grid[0][1].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_3;
+        p.grid[0][2].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_3;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_ProbePuzzle(&p, SUDOKU_PROPAGATE_SINGLES, 2, &counters));
+        CHECK(2 == counters.probes);
+        CHECK(26 == counters.probe_eliminations);
+        CHECK(0 == (p.grid[0][5].candidates & (SUDOKU_MASK_1 | SUDOKU_MASK_3)));
+        CHECK(0 == (p.grid[2][0].candidates & (SUDOKU_MASK_1 | SUDOKU_MASK_3)));
+        CHECK(0 != (p.grid[5][1].candidates & SUDOKU_MASK_1));
+    }
+    SUBCASE("Both candidates fail")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializePuzzle(&p));
+        p.grid[0][0].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_2;
+        p.grid[0][1].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_3;
+        p.grid[0][2].candidates = SUDOKU_MASK_1 | SUDOKU_MASK_3;
+        p.grid[0][3].candidates = SUDOKU_MASK_2 | SUDOKU_MASK_4;
+        p.grid[0][4].candidates = SUDOKU_MASK_2 | SUDOKU_MASK_4;
+        q = p;
+        CHECK(SUDOKU_RC_PRUNE == Sudoku_ProbePuzzle(&q, SUDOKU_PROPAGATE_SINGLES, 0, &counters));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_ProbePuzzle(&p, SUDOKU_PROPAGATE_SINGLES, 2, &counters));
+        CHECK(SUDOKU_RC_ERROR == Sudoku_GetStatus(&p));
+    }
+}
+
+TEST_CASE("Next hint")
+{
+    static struct SudokuDLX_S dlx;
+    struct SudokuPuzzle_S p;
+    struct SudokuPuzzle_S solution;
+    Sudoku_Hint_T hint;
+
+    SUBCASE("NULL Pointer test")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_NextHint(NULL, &hint));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_NextHint(&p, NULL));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_ApplyHint(NULL, &hint));
+    }
+    SUBCASE("Full house")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, validTestPuzzles[1].c_str()));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_NextHint(&p, &hint));
+        CHECK(SUDOKU_HINT_FULL_HOUSE == hint.technique);
+        CHECK(1 == hint.n_cells);
+        CHECK(40 == hint.cells[0]);
+        CHECK(SUDOKU_MASK_3 == hint.values);
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_ApplyHint(&p, &hint));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&p));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_NextHint(&p, &hint));
+        CHECK(SUDOKU_HINT_NONE == hint.technique);
+        CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_ApplyHint(&p, &hint));
+    }
+    SUBCASE("Naked single")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, ".1234....5........6........7........8............................................"));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_NextHint(&p, &hint));
+        CHECK(SUDOKU_HINT_NAKED_SINGLE == hint.technique);
+        CHECK(0 == hint.cells[0]);
+        CHECK(SUDOKU_MASK_9 == hint.values);
+    }
+    SUBCASE("Pointing")
+    {
+        /* The empty cells of the first subgrid are all in the first row */
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, ".........234......567.............................................................."));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_NextHint(&p, &hint));
+        CHECK(SUDOKU_HINT_POINTING == hint.technique);
+        CHECK(18 == hint.unit);
+        CHECK(SUDOKU_MASK_1 == hint.values);
+        CHECK(3 == hint.n_cells);
+        CHECK(6 == hint.n_eliminations);
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_ApplyHint(&p, &hint));
+        CHECK(0 == (p.grid[0][5].candidates & SUDOKU_MASK_1));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_NextHint(&p, &hint));
+        CHECK(SUDOKU_MASK_1 != hint.values); /* Applied eliminations are not hinted again */
+    }
+    SUBCASE("Contradiction")
+    {
+        for (auto x : invalidTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_NOT_SOLVABLE == Sudoku_NextHint(&p, &hint));
+            CHECK(SUDOKU_HINT_CONTRADICTION == hint.technique);
+            CHECK(1 == hint.n_cells);
+        }
+    }
+    SUBCASE("Hints agree with the solution")
+    {
+        for (auto x : validTestPuzzles)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&solution, x.c_str()));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_Solve(&dlx, &solution, 1));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_DLX_StoreSolution(&dlx, &solution));
+
+            while ((SUDOKU_RC_SUCCESS == Sudoku_NextHint(&p, &hint)) && (SUDOKU_HINT_NONE != hint.technique))
+            {
+                if (0 == hint.n_eliminations)
+                {
+                    CHECK(hint.values == solution.grid[hint.cells[0] / 9][hint.cells[0] % 9].value);
+                }
+                for (unsigned int i = 0; i < hint.n_eliminations; i++)
+                {
+                    CHECK(0 == (hint.elim_candidates[i] & solution.grid[hint.elim_cells[i] / 9][hint.elim_cells[i] % 9].value));
+                }
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_ApplyHint(&p, &hint));
+            }
+            CHECK(SUDOKU_HINT_NONE == hint.technique);
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&p));
+        }
+    }
+}
+
+TEST_CASE("Binary dataset records")
+{
+    static const uint32_t flags[] = {0, SUDOKU_DATASET_FLAG_SOLUTION, SUDOKU_DATASET_FLAG_GIVENS, SUDOKU_DATASET_FLAG_GIVENS | SUDOKU_DATASET_FLAG_SOLUTION};
+    const unsigned int max_givens = 81;
+    uint8_t data[SUDOKU_DATASET_HEADER_SIZE + 4 * (SUDOKU_DATASET_GIVENS_MASK_SIZE + 2 * SUDOKU_DATASET_NIBBLES_SIZE)];
+    Sudoku_Dataset_T dataset;
+    struct SudokuPuzzle_S p, p_ref, solution;
+
+    SUBCASE("Record sizes")
+    {
+        CHECK(41 == Sudoku_Dataset_RecordSize(0, 0));
+        CHECK(82 == Sudoku_Dataset_RecordSize(SUDOKU_DATASET_FLAG_SOLUTION, 0));
+        CHECK(20 == Sudoku_Dataset_RecordSize(SUDOKU_DATASET_FLAG_GIVENS, 17));
+        CHECK(61 == Sudoku_Dataset_RecordSize(SUDOKU_DATASET_FLAG_GIVENS | SUDOKU_DATASET_FLAG_SOLUTION, 17));
+    }
+    SUBCASE("Invalid headers")
+    {
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_Dataset_WriteHeader(NULL, 0, 0, 0));
+        CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_WriteHeader(data, 0, 0, 82));
+        CHECK(SUDOKU_RC_NULL_POINTER == Sudoku_Dataset_Open(&dataset, NULL, 0));
+        CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_Open(&dataset, data, SUDOKU_DATASET_HEADER_SIZE - 1));
+
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_WriteHeader(data, 0, 5, 0));
+        CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_Open(&dataset, data, SUDOKU_DATASET_HEADER_SIZE + 4 * SUDOKU_DATASET_NIBBLES_SIZE));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_Open(&dataset, data, SUDOKU_DATASET_HEADER_SIZE + 5 * SUDOKU_DATASET_NIBBLES_SIZE));
+        data[0] = 'X';
+        CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_Open(&dataset, data, sizeof(data)));
+    }
+    SUBCASE("Round trip")
+    {
+        for (auto f : flags)
+        {
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_WriteHeader(data, f, validTestPuzzles.size(), max_givens));
+            CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_Open(&dataset, data, sizeof(data)));
+            CHECK(validTestPuzzles.size() == dataset.count);
+
+            for (size_t i = 0; i < validTestPuzzles.size(); i++)
+            {
+                /* Only the first puzzle has a known solution: itself */
+                const char *known_solution = (0 == i) ? validTestPuzzles[0].c_str() : NULL;
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_EncodeRecord(&dataset, &data[SUDOKU_DATASET_HEADER_SIZE + i * dataset.record_size],
+                                                                       validTestPuzzles[i].c_str(), known_solution));
+            }
+
+            for (size_t i = 0; i < validTestPuzzles.size(); i++)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_Read(&dataset, i, &p, NULL));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_InitializeFromArray(&p_ref, validTestPuzzles[i].c_str()));
+                CHECK(0 == memcmp(&p, &p_ref, sizeof(p)));
+            }
+
+            if (f & SUDOKU_DATASET_FLAG_SOLUTION)
+            {
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_Read(&dataset, 0, &p, &solution));
+                CHECK(SUDOKU_RC_SUCCESS == Sudoku_Check(&solution));
+                CHECK(SUDOKU_RC_NOT_SOLVABLE == Sudoku_Dataset_Read(&dataset, 1, &p, &solution));
+            }
+            else
+            {
+                CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_Read(&dataset, 0, &p, &solution));
+            }
+
+            CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_Read(&dataset, validTestPuzzles.size(), &p, NULL));
+        }
+    }
+    SUBCASE("Givens capacity")
+    {
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_WriteHeader(data, SUDOKU_DATASET_FLAG_GIVENS, 1, 17));
+        CHECK(SUDOKU_RC_SUCCESS == Sudoku_Dataset_Open(&dataset, data, sizeof(data)));
+        CHECK(SUDOKU_RC_INVALID_INPUT == Sudoku_Dataset_EncodeRecord(&dataset, &data[SUDOKU_DATASET_HEADER_SIZE], validTestPuzzles[3].c_str(), NULL));
+    }
+}